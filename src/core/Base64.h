@@ -0,0 +1,45 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace core {
+
+// 표준 base64 (RFC 4648, '=' 패딩) - 양자화된 코어 배열 등 바이트열을 JSON 문자열로 싣는 용도
+constexpr size_t base64Length(size_t bytes) {
+    return (bytes + 2) / 3 * 4;
+}
+
+// out에 base64Length(size) 바이트 기록, 기록 끝 위치 반환 (할당 없음)
+inline char* base64Encode(const uint8_t* data, size_t size, char* out) {
+    static constexpr char kAlphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    size_t i = 0;
+    for (; i + 3 <= size; i += 3) {
+        uint32_t chunk = (uint32_t{data[i]} << 16) | (uint32_t{data[i + 1]} << 8) | data[i + 2];
+        *out++ = kAlphabet[(chunk >> 18) & 0x3F];
+        *out++ = kAlphabet[(chunk >> 12) & 0x3F];
+        *out++ = kAlphabet[(chunk >> 6) & 0x3F];
+        *out++ = kAlphabet[chunk & 0x3F];
+    }
+
+    size_t rest = size - i;
+    if (rest > 0) {
+        uint32_t chunk = uint32_t{data[i]} << 16;
+        if (rest == 2) chunk |= uint32_t{data[i + 1]} << 8;
+        *out++ = kAlphabet[(chunk >> 18) & 0x3F];
+        *out++ = kAlphabet[(chunk >> 12) & 0x3F];
+        *out++ = rest == 2 ? kAlphabet[(chunk >> 6) & 0x3F] : '=';
+        *out++ = '=';
+    }
+    return out;
+}
+
+inline std::string base64Encode(const uint8_t* data, size_t size) {
+    std::string text(base64Length(size), '\0');
+    base64Encode(data, size, text.data());
+    return text;
+}
+
+} // namespace core
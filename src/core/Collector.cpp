@@ -0,0 +1,86 @@
+#include "Collector.h"
+
+namespace core {
+
+Collector::Collector(std::string name, std::chrono::milliseconds period, SampleFn sample_fn,
+                     Clock::time_point origin)
+    : name_(std::move(name))
+    , scheduler_(origin) {
+    scheduler_.addTask(name_, period, [this, sample_fn = std::move(sample_fn)](const TickInfo& tick) {
+        SourceSample sample;
+        sample.timestamp = tick.deadline;
+        sample.lateness = tick.lateness;
+        sample.sequence = tick.sequence;
+
+        sample_fn(sample);
+        sample.duration = std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now() - tick.fired_at);
+
+        if (!ring_.push(sample)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+}
+
+Collector::~Collector() {
+    stop();
+}
+
+void Collector::start() {
+    if (running_.exchange(true)) return;
+
+    thread_ = std::thread([this] {
+        scheduler_.run(running_);
+    });
+}
+
+void Collector::stop() {
+    if (!running_.exchange(false)) return;
+
+    scheduler_.stop();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+int Aggregator::addSource(Collector& collector, MetricMask owned) {
+    SourceState state;
+    state.collector = &collector;
+    state.owned = owned;
+    sources_.push_back(state);
+    return static_cast<int>(sources_.size()) - 1;
+}
+
+void Aggregator::join(Clock::time_point deadline) {
+    for (auto& source : sources_) {
+        if (source.has_pending) {
+            if (source.pending.timestamp > deadline) {
+                continue;
+            }
+            source.current = source.pending;
+            source.valid = true;
+            source.has_pending = false;
+        }
+
+        SourceSample sample;
+        while (source.collector->pop(sample)) {
+            if (sample.timestamp > deadline) {
+                source.pending = sample;
+                source.has_pending = true;
+                break;
+            }
+            source.current = sample;
+            source.valid = true;
+        }
+    }
+}
+
+void Aggregator::merge(MetricFrame& out) const {
+    for (const auto& source : sources_) {
+        if (source.valid) {
+            out.copyFrom(source.current.metrics, source.owned);
+        }
+    }
+}
+
+} // namespace core
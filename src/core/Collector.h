@@ -0,0 +1,88 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "MetricRegistry.h"
+#include "Scheduler.h"
+#include "SpscRing.h"
+
+namespace core {
+
+// 소스 하나의 고정 크기 샘플 (링 버퍼 전달 단위)
+struct SourceSample {
+    std::chrono::steady_clock::time_point timestamp;  // 샘플 기준 시각 (틱 마감)
+    std::chrono::microseconds lateness{0};            // 수집 틱 지연
+    std::chrono::microseconds duration{0};            // 수집 소요 시간
+    uint64_t sequence{0};
+    MetricFrame metrics;                              // 소스는 자기 슬롯만 채움
+};
+
+// 소스별 전용 스레드에서 자체 주기로 샘플링하여 SPSC 링에 게시
+class Collector {
+public:
+    using Clock = std::chrono::steady_clock;
+    using SampleFn = std::function<void(SourceSample&)>;
+    static constexpr size_t kRingCapacity = 64;
+
+    Collector(std::string name, std::chrono::milliseconds period, SampleFn sample_fn,
+              Clock::time_point origin = Clock::now());
+    ~Collector();
+
+    void start();
+    void stop();
+
+    // 소비자(집계 스레드) 전용
+    bool pop(SourceSample& out) { return ring_.pop(out); }
+
+    const std::string& getName() const { return name_; }
+    uint64_t getDroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+    std::vector<TaskStats> getStats() const { return scheduler_.getStats(); }
+
+private:
+    Collector(const Collector&) = delete;
+    Collector& operator=(const Collector&) = delete;
+
+    std::string name_;
+    Scheduler scheduler_;
+    SpscRing<SourceSample, kRingCapacity> ring_;
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> dropped_{0};
+};
+
+// 소스별 링을 비우고 틱 마감 기준으로 최신 샘플을 결합
+class Aggregator {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // 소스 등록, 인덱스 반환 (owned: 이 소스가 채우는 메트릭 슬롯)
+    int addSource(Collector& collector, MetricMask owned = kAllMetrics);
+
+    // deadline 이하 타임스탬프 중 가장 최근 샘플로 갱신 (더 새로운 샘플은 다음 틱으로 보류)
+    void join(Clock::time_point deadline);
+
+    const SourceSample& latest(int source) const { return sources_[source].current; }
+    bool hasSample(int source) const { return sources_[source].valid; }
+    size_t getSourceCount() const { return sources_.size(); }
+
+    // 샘플이 있는 소스의 소유 슬롯을 out에 병합
+    void merge(MetricFrame& out) const;
+
+private:
+    struct SourceState {
+        Collector* collector{nullptr};
+        MetricMask owned{0};
+        SourceSample current;
+        SourceSample pending;
+        bool valid{false};
+        bool has_pending{false};
+    };
+
+    std::vector<SourceState> sources_;
+};
+
+} // namespace core
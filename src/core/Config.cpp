@@ -8,6 +8,15 @@ namespace fs = std::filesystem;
 
 namespace core {
 
+namespace {
+// OBS 본체 프로세스 이름 전체 일치 (Linux comm / Windows 실행 파일 이름)
+#ifdef _WIN32
+constexpr const char* kDefaultProcessNames = "=obs64.exe";
+#else
+constexpr const char* kDefaultProcessNames = "=obs";
+#endif
+}
+
 Config& Config::getInstance() {
     static Config instance;
     return instance;
@@ -77,6 +86,20 @@ void Config::createDefaultConfig() {
     config_data_ = {
         {"net.probe_host", "8.8.8.8"},
         {"net.interval_ms", "1000"},
+        {"net.interface", ""},
+        {"sched.system_ms", "100"},
+        {"sched.disk_ms", "1000"},
+        {"sched.irq_ms", "250"},
+        {"sched.process_ms", "1000"},
+        {"cgroup.root", "/sys/fs/cgroup"},
+        {"disk.device", ""},
+        {"process.names", kDefaultProcessNames},
+        {"process.thread_top_n", "5"},
+        {"process.perf_counters", "true"},
+        {"process.recording_stall_ms", "3000"},
+        {"psi.cgroup", "auto"},
+        {"psi.trigger_stall_ms", "100"},
+        {"psi.trigger_window_ms", "2000"},
         {"ui.theme", "dark"},
         {"ui.simpleMode", "true"},
         {"platform", "soop"},
@@ -121,6 +144,124 @@ void Config::setProbeIntervalMs(int interval_ms) {
     config_data_["net.interval_ms"] = std::to_string(interval_ms);
 }
 
+std::string Config::getNetInterface() const {
+    auto it = config_data_.find("net.interface");
+    return it != config_data_.end() ? it->second : "";
+}
+
+void Config::setNetInterface(const std::string& interface) {
+    config_data_["net.interface"] = interface;
+}
+
+// 스케줄러 설정
+int Config::getSourceIntervalMs(const std::string& source) const {
+    auto it = config_data_.find("sched." + source + "_ms");
+    if (it != config_data_.end()) {
+        return std::stoi(it->second);
+    }
+    
+    // 네트워크는 기존 프로브 간격을 따른다
+    if (source == "network") return getProbeIntervalMs();
+    if (source == "system") return 100;
+    if (source == "irq") return 250;
+    return 1000;
+}
+
+void Config::setSourceIntervalMs(const std::string& source, int interval_ms) {
+    config_data_["sched." + source + "_ms"] = std::to_string(interval_ms);
+}
+
+// cgroup 설정
+std::string Config::getCgroupRoot() const {
+    auto it = config_data_.find("cgroup.root");
+    return it != config_data_.end() ? it->second : "/sys/fs/cgroup";
+}
+
+void Config::setCgroupRoot(const std::string& root) {
+    config_data_["cgroup.root"] = root;
+}
+
+// 디스크 설정
+std::string Config::getDiskDevice() const {
+    auto it = config_data_.find("disk.device");
+    return it != config_data_.end() ? it->second : "";
+}
+
+void Config::setDiskDevice(const std::string& device) {
+    config_data_["disk.device"] = device;
+}
+
+// 감시 프로세스 설정
+std::vector<std::string> Config::getProcessNames() const {
+    auto it = config_data_.find("process.names");
+    std::vector<std::string> names;
+    std::istringstream iss(it != config_data_.end() ? it->second : kDefaultProcessNames);
+    std::string name;
+    while (std::getline(iss, name, ',')) {
+        if (!name.empty()) {
+            names.push_back(name);
+        }
+    }
+    return names;
+}
+
+void Config::setProcessNames(const std::vector<std::string>& names) {
+    std::string joined;
+    for (const auto& name : names) {
+        if (!joined.empty()) joined += ",";
+        joined += name;
+    }
+    config_data_["process.names"] = joined;
+}
+
+int Config::getThreadTopN() const {
+    auto it = config_data_.find("process.thread_top_n");
+    return it != config_data_.end() ? std::stoi(it->second) : 5;
+}
+
+void Config::setThreadTopN(int top_n) {
+    config_data_["process.thread_top_n"] = std::to_string(top_n);
+}
+
+bool Config::getPerfCounters() const {
+    auto it = config_data_.find("process.perf_counters");
+    return it != config_data_.end() ? (it->second == "true") : true;
+}
+
+void Config::setPerfCounters(bool enabled) {
+    config_data_["process.perf_counters"] = enabled ? "true" : "false";
+}
+
+int Config::getRecordingStallMs() const {
+    auto it = config_data_.find("process.recording_stall_ms");
+    return it != config_data_.end() ? std::stoi(it->second) : 3000;
+}
+
+void Config::setRecordingStallMs(int stall_ms) {
+    config_data_["process.recording_stall_ms"] = std::to_string(stall_ms);
+}
+
+// PSI 설정
+std::string Config::getPressureCgroup() const {
+    auto it = config_data_.find("psi.cgroup");
+    return it != config_data_.end() ? it->second : "auto";
+}
+
+void Config::setPressureCgroup(const std::string& cgroup) {
+    config_data_["psi.cgroup"] = cgroup;
+}
+
+int Config::getPressureTriggerStallMs() const {
+    auto it = config_data_.find("psi.trigger_stall_ms");
+    return it != config_data_.end() ? std::stoi(it->second) : 100;
+}
+
+int Config::getPressureTriggerWindowMs() const {
+    // 비특권 프로세스는 2초 배수 윈도우만 등록 가능
+    auto it = config_data_.find("psi.trigger_window_ms");
+    return it != config_data_.end() ? std::stoi(it->second) : 2000;
+}
+
 // UI 설정
 std::string Config::getTheme() const {
     auto it = config_data_.find("ui.theme");
@@ -23,6 +23,38 @@ public:
     void setProbeHost(const std::string& host);
     int getProbeIntervalMs() const;
     void setProbeIntervalMs(int interval_ms);
+    // 업링크 인터페이스 (""=기본 경로 인터페이스 자동 선택, 그 외 인터페이스 이름)
+    std::string getNetInterface() const;
+    void setNetInterface(const std::string& interface);
+    
+    // 스케줄러 설정 (소스별 수집 주기: system, disk, irq, network, pressure, cgroup, process)
+    int getSourceIntervalMs(const std::string& source) const;
+    void setSourceIntervalMs(const std::string& source, int interval_ms);
+    
+    // cgroup v2 마운트 위치 (테스트/특수 환경에서 변경)
+    std::string getCgroupRoot() const;
+    void setCgroupRoot(const std::string& root);
+    
+    // 디스크 설정 (device: ""=가장 바쁜 장치 자동 선택, 그 외 /proc/diskstats 장치 이름)
+    std::string getDiskDevice() const;
+    void setDiskDevice(const std::string& device);
+    
+    // 감시 프로세스 (쉼표 구분 이름, 부분 문자열 매칭 - "=이름"은 전체 일치)
+    // 기본은 OBS 본체만 전체 일치 ("obs"로 두면 obs-browser-page, obs-ffmpeg-mux 같은 보조 프로세스에 붙을 수 있다)
+    std::vector<std::string> getProcessNames() const;
+    void setProcessNames(const std::vector<std::string>& names);
+    int getThreadTopN() const;                 // CPU 상위 스레드 수 (0이면 스레드별 수집 끔)
+    void setThreadTopN(int top_n);
+    bool getPerfCounters() const;              // perf_event_open 소프트웨어 카운터 (문맥 전환/이주/페이지 폴트)
+    void setPerfCounters(bool enabled);
+    int getRecordingStallMs() const;           // 녹화 중 쓰기 0이 이만큼 이어지면 recording_stall 이벤트
+    void setRecordingStallMs(int stall_ms);
+    
+    // PSI 설정 (cgroup: "auto"=자기 cgroup 자동 탐지, ""=시스템 전체, 그 외 디렉터리 경로)
+    std::string getPressureCgroup() const;
+    void setPressureCgroup(const std::string& cgroup);
+    int getPressureTriggerStallMs() const;     // 0이면 트리거 사용 안 함
+    int getPressureTriggerWindowMs() const;
     
     // UI 설정
     std::string getTheme() const;
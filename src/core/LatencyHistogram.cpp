@@ -0,0 +1,225 @@
+#include "LatencyHistogram.h"
+#include "Base64.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace core {
+
+namespace {
+constexpr uint8_t kFormatVersion = 1;
+constexpr uint64_t kSubBucketMask = (uint64_t{1} << LatencyHistogram::kSubBucketBits) - 1;
+
+void putVarint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+bool getVarint(const uint8_t*& data, const uint8_t* end, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && data < end; shift += 7) {
+        uint8_t byte = *data++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+uint64_t zigzag(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t unzigzag(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+// 분위수에 해당하는 누적 개수 (반올림 - 0.999 * 1000이 1000으로 올라가지 않게)
+uint64_t countAtPercentile(double percentile, uint64_t total) {
+    auto count = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(total) + 0.5);
+    return std::max<uint64_t>(1, count);
+}
+}
+
+size_t LatencyHistogram::indexOf(uint64_t us) {
+    // 값이 속한 2의 거듭제곱 구간(bucket)과 그 안의 칸(sub bucket)
+    int bucket = (64 - std::countl_zero(us | kSubBucketMask)) - kSubBucketBits;
+    uint64_t sub = us >> bucket;
+    return (static_cast<size_t>(bucket + 1) << (kSubBucketBits - 1)) + static_cast<size_t>(sub - kSubBucketHalf);
+}
+
+uint64_t LatencyHistogram::lowestEquivalentUs(size_t index) {
+    int bucket = static_cast<int>(index >> (kSubBucketBits - 1)) - 1;
+    uint64_t sub = (index & (kSubBucketHalf - 1)) + kSubBucketHalf;
+    if (bucket < 0) {
+        bucket = 0;
+        sub = index;   // 첫 구간은 0 ~ 127을 1us 단위로
+    }
+    return sub << bucket;
+}
+
+uint64_t LatencyHistogram::highestEquivalentUs(size_t index) {
+    int bucket = std::max(static_cast<int>(index >> (kSubBucketBits - 1)) - 1, 0);
+    return lowestEquivalentUs(index) + (uint64_t{1} << bucket) - 1;
+}
+
+void LatencyHistogram::record(double ms) {
+    recordUs(ms > 0 ? static_cast<uint64_t>(std::llround(ms * 1000.0)) : 0);
+}
+
+void LatencyHistogram::recordUs(uint64_t us) {
+    us = std::min(us, kMaxValueUs);
+    ++counts_[indexOf(us)];
+    ++total_;
+    min_us_ = std::min(min_us_, us);
+    max_us_ = std::max(max_us_, us);
+}
+
+void LatencyHistogram::add(const LatencyHistogram& other) {
+    if (other.total_ == 0) {
+        return;
+    }
+    for (size_t i = 0; i < kCountsLength; ++i) {
+        counts_[i] += other.counts_[i];
+    }
+    total_ += other.total_;
+    min_us_ = std::min(min_us_, other.min_us_);
+    max_us_ = std::max(max_us_, other.max_us_);
+}
+
+void LatencyHistogram::reset() {
+    counts_.fill(0);
+    total_ = 0;
+    min_us_ = UINT64_MAX;
+    max_us_ = 0;
+}
+
+double LatencyHistogram::valueAtPercentile(double percentile) const {
+    if (total_ == 0) {
+        return 0.0;
+    }
+    uint64_t target = countAtPercentile(std::clamp(percentile, 0.0, 100.0), total_);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kCountsLength; ++i) {
+        seen += counts_[i];
+        if (seen >= target) {
+            return static_cast<double>(std::min(highestEquivalentUs(i), max_us_)) / 1000.0;
+        }
+    }
+    return getMaxMs();
+}
+
+LatencyPercentiles LatencyHistogram::getPercentiles() const {
+    LatencyPercentiles result;
+    if (total_ == 0) {
+        return result;
+    }
+    constexpr double kQuantiles[] = {50.0, 90.0, 99.0, 99.9};
+    double* outputs[] = {&result.p50, &result.p90, &result.p99, &result.p999};
+    size_t next = 0;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kCountsLength && next < 4; ++i) {
+        seen += counts_[i];
+        // 같은 칸에서 여러 분위수가 끝날 수 있다
+        while (next < 4 && seen >= countAtPercentile(kQuantiles[next], total_)) {
+            *outputs[next++] = static_cast<double>(std::min(highestEquivalentUs(i), max_us_)) / 1000.0;
+        }
+    }
+    return result;
+}
+
+void LatencyHistogram::serialize(std::vector<uint8_t>& out) const {
+    out.clear();
+    out.push_back(kFormatVersion);
+    out.push_back(kSubBucketBits);
+    putVarint(out, total_ ? min_us_ : 0);
+    putVarint(out, max_us_);
+
+    size_t last = total_ ? indexOf(max_us_) : 0;
+    int64_t zeros = 0;
+    for (size_t i = 0; total_ && i <= last; ++i) {
+        if (counts_[i] == 0) {
+            ++zeros;
+            continue;
+        }
+        if (zeros > 0) {
+            putVarint(out, zigzag(-zeros));
+            zeros = 0;
+        }
+        putVarint(out, zigzag(counts_[i]));
+    }
+}
+
+std::string LatencyHistogram::encode() const {
+    std::vector<uint8_t> bytes;
+    serialize(bytes);
+    return base64Encode(bytes.data(), bytes.size());
+}
+
+bool LatencyHistogram::deserialize(const uint8_t* data, size_t size, LatencyHistogram& histogram) {
+    histogram.reset();
+    const uint8_t* end = data + size;
+    if (size < 2 || data[0] != kFormatVersion || data[1] != kSubBucketBits) {
+        return false;
+    }
+    data += 2;
+    uint64_t min_us = 0;
+    uint64_t max_us = 0;
+    if (!getVarint(data, end, min_us) || !getVarint(data, end, max_us)) {
+        return false;
+    }
+
+    size_t index = 0;
+    while (data < end) {
+        uint64_t raw = 0;
+        if (!getVarint(data, end, raw)) return false;
+        int64_t value = unzigzag(raw);
+        if (value < 0) {
+            index += static_cast<size_t>(-value);
+            continue;
+        }
+        if (index >= kCountsLength || value > UINT32_MAX) return false;
+        histogram.counts_[index++] = static_cast<uint32_t>(value);
+        histogram.total_ += static_cast<uint64_t>(value);
+    }
+    if (histogram.total_ > 0) {
+        histogram.min_us_ = min_us;
+        histogram.max_us_ = max_us;
+    }
+    return true;
+}
+
+LatencyWindow::LatencyWindow(std::chrono::seconds slot)
+    : slot_(slot) {}
+
+void LatencyWindow::add(const LatencyHistogram& interval, Clock::time_point now) {
+    if (!started_) {
+        slot_start_ = now;
+        started_ = true;
+    }
+    rotate(now);
+    slots_[current_].add(interval);
+    merged_.add(interval);
+}
+
+void LatencyWindow::rotate(Clock::time_point now) {
+    if (now - slot_start_ < slot_) {
+        return;
+    }
+    // 지난 구간 수만큼 밀어낸다 (창 전체보다 오래 비었으면 전부 비움)
+    auto elapsed = static_cast<size_t>((now - slot_start_) / slot_);
+    for (size_t i = 0; i < std::min(elapsed, kSlots); ++i) {
+        current_ = (current_ + 1) % kSlots;
+        slots_[current_].reset();
+    }
+    slot_start_ += slot_ * elapsed;
+
+    merged_.reset();
+    for (const auto& slot : slots_) {
+        merged_.add(slot);
+    }
+}
+
+} // namespace core
@@ -0,0 +1,84 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace core {
+
+// 지연 분위수 (ms)
+struct LatencyPercentiles {
+    double p50{0};
+    double p90{0};
+    double p99{0};
+    double p999{0};
+};
+
+// HdrHistogram식 로그-선형 지연 히스토그램 (마이크로초 단위, 1us ~ 67s)
+// 2의 거듭제곱 구간마다 64칸으로 나눠 유효 숫자 2자리(상대 오차 < 1/64)를 유지한다.
+// 기록은 비트 연산 몇 번 + 카운터 증가뿐(O(1), 할당 없음)이고 크기는 고정(약 5.4KB).
+// 같은 형식끼리 더할 수 있어 구간 스냅샷을 합쳐 더 긴 구간/여러 호스트 분포를 만든다.
+class LatencyHistogram {
+public:
+    static constexpr int kSubBucketBits = 7;
+    static constexpr size_t kSubBucketHalf = size_t{1} << (kSubBucketBits - 1);
+    static constexpr size_t kBucketCount = 20;
+    static constexpr uint64_t kMaxValueUs = (uint64_t{1} << (kSubBucketBits + kBucketCount - 1)) - 1;
+    static constexpr size_t kCountsLength = (kBucketCount + 1) * kSubBucketHalf;
+
+    void record(double ms);
+    void recordUs(uint64_t us);            // kMaxValueUs를 넘으면 최대값 칸에 기록
+    void add(const LatencyHistogram& other);
+    void reset();
+
+    uint64_t getTotalCount() const { return total_; }
+    double getMinMs() const { return total_ ? static_cast<double>(min_us_) / 1000.0 : 0.0; }
+    double getMaxMs() const { return static_cast<double>(max_us_) / 1000.0; }
+
+    // 분위수 (0~100), 해당 칸의 가장 큰 동등값 (최대 기록값을 넘지 않음)
+    double valueAtPercentile(double percentile) const;
+    // p50/p90/p99/p99.9를 한 번의 순회로
+    LatencyPercentiles getPercentiles() const;
+
+    // 압축 직렬화: 버전, 정밀도, min/max 뒤에 칸 값을 ZigZag LEB128로 (연속된 빈 칸은 음수 하나로)
+    void serialize(std::vector<uint8_t>& out) const;
+    std::string encode() const;            // serialize + base64 (JSON용)
+    static bool deserialize(const uint8_t* data, size_t size, LatencyHistogram& histogram);
+
+    static size_t indexOf(uint64_t us);
+    static uint64_t lowestEquivalentUs(size_t index);
+    static uint64_t highestEquivalentUs(size_t index);
+
+private:
+    std::array<uint32_t, kCountsLength> counts_{};
+    uint64_t total_{0};
+    uint64_t min_us_{UINT64_MAX};
+    uint64_t max_us_{0};
+};
+
+// 구간 스냅샷을 이어 붙인 이동 창 - slot 길이마다 가장 오래된 구간을 버린다
+class LatencyWindow {
+public:
+    using Clock = std::chrono::steady_clock;
+    static constexpr size_t kSlots = 6;
+
+    explicit LatencyWindow(std::chrono::seconds slot = std::chrono::seconds(10));
+
+    void add(const LatencyHistogram& interval, Clock::time_point now);
+    // 창 전체 (최근 slot x kSlots)
+    const LatencyHistogram& get() const { return merged_; }
+
+private:
+    void rotate(Clock::time_point now);
+
+    std::chrono::seconds slot_;
+    std::array<LatencyHistogram, kSlots> slots_{};
+    size_t current_{0};
+    Clock::time_point slot_start_{};
+    bool started_{false};
+    LatencyHistogram merged_;
+};
+
+} // namespace core
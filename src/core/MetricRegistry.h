@@ -0,0 +1,275 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+
+namespace core {
+
+// 메트릭 ID - 값 자체가 스냅샷 슬롯 인덱스
+enum class MetricId : uint8_t {
+    CpuPct,
+    CpuUserPct,
+    CpuSystemPct,
+    CpuIowaitPct,
+    CpuStealPct,
+    MemoryPct,
+    MemMb,
+    GpuPct,
+    DiskPct,
+    DiskReadMbps,
+    DiskWriteMbps,
+    DiskIops,
+    DiskQueueDepth,
+    DiskAwaitMs,
+    DiskUtilPct,
+    RttMs,
+    RttMinMs,
+    RttUserMs,
+    RttKernelMs,
+    RttHostDelayMs,
+    JitterMs,
+    RttP50Ms,
+    RttP90Ms,
+    RttP99Ms,
+    RttP999Ms,
+    LossPct,
+    LossBurst,
+    UplinkKbps,
+    NetRxKbps,
+    NetTxPps,
+    NetRxPps,
+    NetErrorsPerSec,
+    NetDropsPerSec,
+    TickLateMs,
+    PsiCpuSomeAvg10,
+    PsiCpuFullAvg10,
+    PsiMemSomeAvg10,
+    PsiMemFullAvg10,
+    PsiIoSomeAvg10,
+    PsiIoFullAvg10,
+    PsiCpuSomeUs,
+    PsiCpuFullUs,
+    PsiMemSomeUs,
+    PsiMemFullUs,
+    PsiIoSomeUs,
+    PsiIoFullUs,
+    CgroupCpuPct,
+    CgroupThrottledPct,
+    CgroupMemMb,
+    CgroupMemPct,
+    CgroupIoReadMbps,
+    CgroupIoWriteMbps,
+    CgroupIoIops,
+    CtxtPerSec,
+    IntrPerSec,
+    SoftirqPerSec,
+    SoftirqNetRxPerSec,
+    SoftirqNetRxMaxPerSec,
+    SoftirqNetRxMaxCore,
+    Count
+};
+
+inline constexpr size_t kMetricCount = static_cast<size_t>(MetricId::Count);
+
+// 메트릭을 채우는 수집 소스
+enum class MetricSource : uint8_t { System, Disk, Network, Runtime, Pressure, Cgroup, Interrupt };
+
+struct MetricInfo {
+    MetricId id;
+    std::string_view key;     // 직렬화/설정/리포트에서 쓰는 이름
+    std::string_view unit;
+    MetricSource source;
+};
+
+// 모든 메트릭의 단일 스키마 (MetricId 순서)
+inline constexpr std::array<MetricInfo, kMetricCount> kMetricRegistry{{
+    {MetricId::CpuPct,                "cpu_pct",                  "%",    MetricSource::System},
+    {MetricId::CpuUserPct,            "cpu_user_pct",             "%",    MetricSource::System},
+    {MetricId::CpuSystemPct,          "cpu_system_pct",           "%",    MetricSource::System},
+    {MetricId::CpuIowaitPct,          "cpu_iowait_pct",           "%",    MetricSource::System},
+    {MetricId::CpuStealPct,           "cpu_steal_pct",            "%",    MetricSource::System},
+    {MetricId::MemoryPct,             "memory_pct",               "%",    MetricSource::System},
+    {MetricId::MemMb,                 "mem_mb",                   "MB",   MetricSource::System},
+    {MetricId::GpuPct,                "gpu_pct",                  "%",    MetricSource::System},
+    {MetricId::DiskPct,               "disk_pct",                 "%",    MetricSource::Disk},
+    {MetricId::DiskReadMbps,          "disk_read_mbps",           "MB/s", MetricSource::Disk},
+    {MetricId::DiskWriteMbps,         "disk_write_mbps",          "MB/s", MetricSource::Disk},
+    {MetricId::DiskIops,              "disk_iops",                "iops", MetricSource::Disk},
+    {MetricId::DiskQueueDepth,        "disk_queue_depth",         "req",  MetricSource::Disk},
+    {MetricId::DiskAwaitMs,           "disk_await_ms",            "ms",   MetricSource::Disk},
+    {MetricId::DiskUtilPct,           "disk_util_pct",            "%",    MetricSource::Disk},
+    {MetricId::RttMs,                 "rtt_ms",                   "ms",   MetricSource::Network},
+    {MetricId::RttMinMs,              "rtt_min_ms",               "ms",   MetricSource::Network},
+    {MetricId::RttUserMs,             "rtt_user_ms",              "ms",   MetricSource::Network},
+    {MetricId::RttKernelMs,           "rtt_kernel_ms",            "ms",   MetricSource::Network},
+    {MetricId::RttHostDelayMs,        "rtt_host_delay_ms",        "ms",   MetricSource::Network},
+    {MetricId::JitterMs,              "jitter_ms",                "ms",   MetricSource::Network},
+    {MetricId::RttP50Ms,              "rtt_p50_ms",               "ms",   MetricSource::Network},
+    {MetricId::RttP90Ms,              "rtt_p90_ms",               "ms",   MetricSource::Network},
+    {MetricId::RttP99Ms,              "rtt_p99_ms",               "ms",   MetricSource::Network},
+    {MetricId::RttP999Ms,             "rtt_p999_ms",              "ms",   MetricSource::Network},
+    {MetricId::LossPct,               "loss_pct",                 "%",    MetricSource::Network},
+    {MetricId::LossBurst,             "loss_burst",               "pkt",  MetricSource::Network},
+    {MetricId::UplinkKbps,            "uplink_kbps",              "kbps", MetricSource::Network},
+    {MetricId::NetRxKbps,             "net_rx_kbps",              "kbps", MetricSource::Network},
+    {MetricId::NetTxPps,              "net_tx_pps",               "pps",  MetricSource::Network},
+    {MetricId::NetRxPps,              "net_rx_pps",               "pps",  MetricSource::Network},
+    {MetricId::NetErrorsPerSec,       "net_errors_per_s",         "/s",   MetricSource::Network},
+    {MetricId::NetDropsPerSec,        "net_drops_per_s",          "/s",   MetricSource::Network},
+    {MetricId::TickLateMs,            "tick_late_ms",             "ms",   MetricSource::Runtime},
+    {MetricId::PsiCpuSomeAvg10,       "psi_cpu_some_avg10",       "%",    MetricSource::Pressure},
+    {MetricId::PsiCpuFullAvg10,       "psi_cpu_full_avg10",       "%",    MetricSource::Pressure},
+    {MetricId::PsiMemSomeAvg10,       "psi_mem_some_avg10",       "%",    MetricSource::Pressure},
+    {MetricId::PsiMemFullAvg10,       "psi_mem_full_avg10",       "%",    MetricSource::Pressure},
+    {MetricId::PsiIoSomeAvg10,        "psi_io_some_avg10",        "%",    MetricSource::Pressure},
+    {MetricId::PsiIoFullAvg10,        "psi_io_full_avg10",        "%",    MetricSource::Pressure},
+    {MetricId::PsiCpuSomeUs,          "psi_cpu_some_us",          "us",   MetricSource::Pressure},
+    {MetricId::PsiCpuFullUs,          "psi_cpu_full_us",          "us",   MetricSource::Pressure},
+    {MetricId::PsiMemSomeUs,          "psi_mem_some_us",          "us",   MetricSource::Pressure},
+    {MetricId::PsiMemFullUs,          "psi_mem_full_us",          "us",   MetricSource::Pressure},
+    {MetricId::PsiIoSomeUs,           "psi_io_some_us",           "us",   MetricSource::Pressure},
+    {MetricId::PsiIoFullUs,           "psi_io_full_us",           "us",   MetricSource::Pressure},
+    {MetricId::CgroupCpuPct,          "cgroup_cpu_pct",           "%",    MetricSource::Cgroup},
+    {MetricId::CgroupThrottledPct,    "cgroup_throttled_pct",     "%",    MetricSource::Cgroup},
+    {MetricId::CgroupMemMb,           "cgroup_mem_mb",            "MB",   MetricSource::Cgroup},
+    {MetricId::CgroupMemPct,          "cgroup_mem_pct",           "%",    MetricSource::Cgroup},
+    {MetricId::CgroupIoReadMbps,      "cgroup_io_read_mbps",      "MB/s", MetricSource::Cgroup},
+    {MetricId::CgroupIoWriteMbps,     "cgroup_io_write_mbps",     "MB/s", MetricSource::Cgroup},
+    {MetricId::CgroupIoIops,          "cgroup_io_iops",           "iops", MetricSource::Cgroup},
+    {MetricId::CtxtPerSec,            "ctxt_per_s",               "/s",   MetricSource::Interrupt},
+    {MetricId::IntrPerSec,            "intr_per_s",               "/s",   MetricSource::Interrupt},
+    {MetricId::SoftirqPerSec,         "softirq_per_s",            "/s",   MetricSource::Interrupt},
+    {MetricId::SoftirqNetRxPerSec,    "softirq_net_rx_per_s",     "/s",   MetricSource::Interrupt},
+    {MetricId::SoftirqNetRxMaxPerSec, "softirq_net_rx_max_per_s", "/s",   MetricSource::Interrupt},
+    {MetricId::SoftirqNetRxMaxCore,   "softirq_net_rx_max_core",  "cpu",  MetricSource::Interrupt},
+}};
+
+constexpr size_t metricIndex(MetricId id) {
+    return static_cast<size_t>(id);
+}
+
+constexpr const MetricInfo& metricInfo(MetricId id) {
+    return kMetricRegistry[metricIndex(id)];
+}
+
+constexpr std::string_view metricKey(MetricId id) {
+    return metricInfo(id).key;
+}
+
+// 런타임 이름 조회 (설정/명령 파싱용), 없으면 false
+constexpr bool findMetric(std::string_view key, MetricId& id) {
+    for (const auto& info : kMetricRegistry) {
+        if (info.key == key) {
+            id = info.id;
+            return true;
+        }
+    }
+    return false;
+}
+
+// 컴파일 타임 이름 조회 - 오타는 컴파일 오류
+consteval MetricId metricId(std::string_view key) {
+    MetricId id{};
+    if (!findMetric(key, id)) {
+        throw "unknown metric key";
+    }
+    return id;
+}
+
+namespace detail {
+constexpr bool isRegistryDense() {
+    for (size_t i = 0; i < kMetricRegistry.size(); ++i) {
+        if (metricIndex(kMetricRegistry[i].id) != i) return false;
+        for (size_t j = 0; j < i; ++j) {
+            if (kMetricRegistry[j].key == kMetricRegistry[i].key) return false;
+        }
+    }
+    return true;
+}
+} // namespace detail
+
+static_assert(detail::isRegistryDense(), "kMetricRegistry must list every MetricId once, in order, with unique keys");
+
+// 메트릭 집합 비트마스크 (소스별 소유 슬롯 표시)
+using MetricMask = uint64_t;
+static_assert(kMetricCount <= sizeof(MetricMask) * 8, "MetricMask too narrow");
+
+inline constexpr MetricMask kAllMetrics =
+    kMetricCount == sizeof(MetricMask) * 8 ? ~MetricMask{0} : (MetricMask{1} << kMetricCount) - 1;
+
+constexpr MetricMask metricMask(std::initializer_list<MetricId> ids) {
+    MetricMask mask = 0;
+    for (auto id : ids) {
+        mask |= MetricMask{1} << metricIndex(id);
+    }
+    return mask;
+}
+
+constexpr MetricMask sourceMask(MetricSource source) {
+    MetricMask mask = 0;
+    for (const auto& info : kMetricRegistry) {
+        if (info.source == source) {
+            mask |= MetricMask{1} << metricIndex(info.id);
+        }
+    }
+    return mask;
+}
+
+// 코어별 부하 - 코어당 1바이트로 양자화 (0..200 = 0..100%, 0.5% 단위)
+// 128코어 x 3배열도 한 틱에 384바이트라 10Hz 스트림/리포트에 그대로 실을 수 있다.
+struct CoreLoad {
+    static constexpr size_t kMaxCores = 256;
+    static constexpr double kScale = 0.5;            // 저장값 x kScale = %
+    static constexpr uint8_t kMaxValue = 200;
+
+    uint16_t count{0};
+    std::array<uint8_t, kMaxCores> busy{};           // 100 - idle - iowait (steal 포함)
+    std::array<uint8_t, kMaxCores> iowait{};
+    std::array<uint8_t, kMaxCores> steal{};
+    std::array<uint8_t, kMaxCores> net_rx{};         // 코어별 NET_RX softirq 비중 (irq 소스가 채움)
+
+    static constexpr double toPercent(uint8_t value) { return value * kScale; }
+
+    // float % 배열을 1바이트 값으로 (반올림 + 0..kMaxValue 클램프, 분기 없는 루프)
+    static void quantize(const float* __restrict pct, uint8_t* __restrict out, size_t count) {
+        constexpr float kStepsPerPercent = static_cast<float>(1.0 / kScale);
+        constexpr float kMax = kMaxValue;
+        for (size_t i = 0; i < count; ++i) {
+            float steps = std::min(std::max(pct[i] * kStepsPerPercent + 0.5f, 0.0f), kMax);
+            out[i] = static_cast<uint8_t>(steps);
+        }
+    }
+};
+
+// 한 틱의 메트릭 스냅샷 - ID로 인덱싱되는 dense 슬롯 배열 (해시/트리 없음)
+struct MetricFrame {
+    int64_t ts{0};                                   // unix 초
+    std::array<double, kMetricCount> values{};
+    CoreLoad cores;                                  // count/busy/iowait/steal은 CpuPct, net_rx는 SoftirqNetRxPerSec 소유 소스가 채움
+
+    double& operator[](MetricId id) { return values[metricIndex(id)]; }
+    double operator[](MetricId id) const { return values[metricIndex(id)]; }
+
+    // mask에 속한 슬롯만 other에서 복사
+    void copyFrom(const MetricFrame& other, MetricMask mask) {
+        for (size_t i = 0; i < kMetricCount; ++i) {
+            if (mask & (MetricMask{1} << i)) {
+                values[i] = other.values[i];
+            }
+        }
+        if (mask & metricMask({MetricId::CpuPct})) {
+            cores.count = other.cores.count;
+            cores.busy = other.cores.busy;
+            cores.iowait = other.cores.iowait;
+            cores.steal = other.cores.steal;
+        }
+        if (mask & metricMask({MetricId::SoftirqNetRxPerSec})) {
+            cores.net_rx = other.cores.net_rx;
+        }
+    }
+};
+
+} // namespace core
@@ -125,13 +125,14 @@ void PerformanceManager::generatePerformanceReport() {
     
     // SystemMetrics를 사용하여 현재 시스템 상태 수집
     auto& system_metrics = SystemMetrics::getInstance();
-    auto metrics = system_metrics.getMetrics();
-    
-    current_report_.cpu_usage_percent = metrics.value("cpu_pct", 0.0);
-    current_report_.gpu_usage_percent = metrics.value("gpu_pct", 0.0);
-    current_report_.memory_usage_percent = metrics.value("memory_pct", 0.0);
-    current_report_.disk_usage_percent = metrics.value("disk_pct", 0.0);
-    current_report_.network_usage_mbps = metrics.value("network_mbps", 0.0);
+    MetricFrame metrics;
+    system_metrics.collect(metrics);
+    
+    current_report_.cpu_usage_percent = metrics[MetricId::CpuPct];
+    current_report_.gpu_usage_percent = metrics[MetricId::GpuPct];
+    current_report_.memory_usage_percent = metrics[MetricId::MemoryPct];
+    current_report_.disk_usage_percent = metrics[MetricId::DiskPct];
+    current_report_.network_usage_mbps = 0.0;  // SystemMetrics 수집 대상 아님
     current_report_.timestamp = std::chrono::system_clock::now();
     
     // 메모리 사용량을 MB로 변환 (대략적 계산)
@@ -1,4 +1,5 @@
 #include "ReportWriter.h"
+#include "Base64.h"
 #include <fstream>
 #include <filesystem>
 #include <algorithm>
@@ -38,6 +39,15 @@ void ReportWriter::addSnapshot(double rtt, double loss, double dropped, double r
     addSnapshot(MetricSnapshot(rtt, loss, dropped, render, cpu, gpu, mem));
 }
 
+void ReportWriter::addSnapshot(const MetricFrame& frame, double dropped, double render,
+                               const LatencyHistogram* rtt_histogram) {
+    MetricSnapshot snapshot(frame, dropped, render);
+    if (rtt_histogram) {
+        snapshot.rtt_histogram = rtt_histogram->encode();
+    }
+    addSnapshot(snapshot);
+}
+
 void ReportWriter::flushNow() {
     if (!config_.enable) return;
     
@@ -181,7 +191,10 @@ bool ReportWriter::writeCsvFile(const std::string& path) const {
         }
         
         // Write header
-        file << "ts,rtt_ms,loss_pct,obs_dropped_ratio,avg_render_ms,cpu_pct,gpu_pct,mem_mb\n";
+        // cores_busy: 코어당 1바이트(x0.5 = %)의 base64 - 코어 수와 무관하게 한 열
+        // rtt_hist: LatencyHistogram 압축 직렬화의 base64 (없으면 빈 칸)
+        file << "ts,rtt_p50_ms,rtt_p90_ms,rtt_p99_ms,rtt_p999_ms,loss_pct,obs_dropped_ratio,avg_render_ms,"
+                "cpu_pct,gpu_pct,mem_mb,cores_busy,rtt_hist\n";
         
         // Write data
         std::lock_guard<std::mutex> lock(mutex_);
@@ -192,13 +205,18 @@ bool ReportWriter::writeCsvFile(const std::string& path) const {
             
             file << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S") 
                  << "." << std::setfill('0') << std::setw(3) << ms << ","
-                 << snapshot.rtt_ms << ","
+                 << snapshot.rtt.p50 << ","
+                 << snapshot.rtt.p90 << ","
+                 << snapshot.rtt.p99 << ","
+                 << snapshot.rtt.p999 << ","
                  << snapshot.loss_pct << ","
                  << snapshot.obs_dropped_ratio << ","
                  << snapshot.avg_render_ms << ","
                  << snapshot.cpu_pct << ","
                  << snapshot.gpu_pct << ","
-                 << snapshot.mem_mb << "\n";
+                 << snapshot.mem_mb << ","
+                 << base64Encode(snapshot.cores_busy.data(), snapshot.cores_busy.size()) << ","
+                 << snapshot.rtt_histogram << "\n";
         }
         
         return true;
@@ -213,7 +231,10 @@ bool ReportWriter::writeJsonFile(const std::string& path) const {
         j["metadata"] = {
             {"exportTime", std::chrono::system_clock::now().time_since_epoch().count()},
             {"totalSnapshots", snapshots_.size()},
-            {"flushIntervalSec", config_.flushIntervalSec}
+            {"flushIntervalSec", config_.flushIntervalSec},
+            {"coresEncoding", "u8b64"},
+            {"coresScale", CoreLoad::kScale},
+            {"rttHistogramEncoding", "hdr-zigzag-b64"}
         };
         
         nlohmann::json snapshotsArray = nlohmann::json::array();
@@ -223,13 +244,22 @@ bool ReportWriter::writeJsonFile(const std::string& path) const {
             nlohmann::json snapshotJson;
             snapshotJson["timestamp"] = std::chrono::duration_cast<std::chrono::milliseconds>(
                 snapshot.timestamp.time_since_epoch()).count();
-            snapshotJson["rtt_ms"] = snapshot.rtt_ms;
+            snapshotJson["rtt"] = {
+                {"p50", snapshot.rtt.p50},
+                {"p90", snapshot.rtt.p90},
+                {"p99", snapshot.rtt.p99},
+                {"p999", snapshot.rtt.p999}
+            };
+            if (!snapshot.rtt_histogram.empty()) {
+                snapshotJson["rtt"]["hist"] = snapshot.rtt_histogram;
+            }
             snapshotJson["loss_pct"] = snapshot.loss_pct;
             snapshotJson["obs_dropped_ratio"] = snapshot.obs_dropped_ratio;
             snapshotJson["avg_render_ms"] = snapshot.avg_render_ms;
             snapshotJson["cpu_pct"] = snapshot.cpu_pct;
             snapshotJson["gpu_pct"] = snapshot.gpu_pct;
             snapshotJson["mem_mb"] = snapshot.mem_mb;
+            snapshotJson["cores_busy"] = base64Encode(snapshot.cores_busy.data(), snapshot.cores_busy.size());
             snapshotsArray.push_back(snapshotJson);
         }
         
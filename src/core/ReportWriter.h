@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <mutex>
@@ -7,30 +8,44 @@
 #include <thread>
 #include <atomic>
 #include <nlohmann/json.hpp>
+#include "LatencyHistogram.h"
+#include "MetricRegistry.h"
 
 namespace core {
 
 struct MetricSnapshot {
     std::chrono::system_clock::time_point timestamp;
-    double rtt_ms;
+    LatencyPercentiles rtt;            // 최근 RTT 분포의 분위수 (단일 값이면 모두 같은 값)
+    std::string rtt_histogram;         // LatencyHistogram::encode() - 없으면 빈 문자열
     double loss_pct;
     double obs_dropped_ratio;
     double avg_render_ms;
     double cpu_pct;
     double gpu_pct;
     double mem_mb;
+    std::vector<uint8_t> cores_busy;   // 코어별 사용률 (CoreLoad 양자화 값)
     
     MetricSnapshot() = default;
     MetricSnapshot(double rtt, double loss, double dropped, double render, 
                    double cpu, double gpu, double mem)
         : timestamp(std::chrono::system_clock::now())
-        , rtt_ms(rtt)
+        , rtt{rtt, rtt, rtt, rtt}
         , loss_pct(loss)
         , obs_dropped_ratio(dropped)
         , avg_render_ms(render)
         , cpu_pct(cpu)
         , gpu_pct(gpu)
         , mem_mb(mem) {}
+    
+    // 레지스트리 스냅샷 + OBS 값 (OBS는 레지스트리 밖에서 수집)
+    MetricSnapshot(const MetricFrame& frame, double dropped, double render)
+        : MetricSnapshot(frame[MetricId::RttMs], frame[MetricId::LossPct], dropped, render,
+                         frame[MetricId::CpuPct], frame[MetricId::GpuPct], frame[MetricId::MemMb]) {
+        rtt = {frame[MetricId::RttP50Ms], frame[MetricId::RttP90Ms],
+               frame[MetricId::RttP99Ms], frame[MetricId::RttP999Ms]};
+        size_t count = std::min<size_t>(frame.cores.count, CoreLoad::kMaxCores);
+        cores_busy.assign(frame.cores.busy.begin(), frame.cores.busy.begin() + count);
+    }
 };
 
 struct ReportConfig {
@@ -51,6 +66,8 @@ public:
     void addSnapshot(const MetricSnapshot& snapshot);
     void addSnapshot(double rtt, double loss, double dropped, double render, 
                      double cpu, double gpu, double mem);
+    void addSnapshot(const MetricFrame& frame, double dropped = 0.0, double render = 0.0,
+                     const LatencyHistogram* rtt_histogram = nullptr);
     
     // Manual control
     void flushNow();
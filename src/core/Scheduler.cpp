@@ -0,0 +1,244 @@
+#include "Scheduler.h"
+#include <algorithm>
+#include <iostream>
+
+namespace core {
+
+Scheduler::Scheduler(Clock::time_point origin, std::chrono::microseconds resolution)
+    : origin_(origin)
+    , resolution_(resolution.count() > 0 ? resolution : std::chrono::microseconds(1000)) {
+    scratch_.reserve(16);
+}
+
+int Scheduler::addTask(const std::string& name, std::chrono::milliseconds period, Callback callback) {
+    if (period.count() <= 0) {
+        period = std::chrono::milliseconds(1);
+    }
+
+    // 원점 기준 주기 경계에 정렬 -> 배수 관계인 작업들이 같은 틱에 맞물린다
+    auto now = Clock::now();
+    auto elapsed = now - origin_;
+    auto periods = elapsed / period + 1;
+
+    Task task;
+    task.name = name;
+    task.period = period;
+    task.callback = std::move(callback);
+    task.deadline = origin_ + period * periods;
+    task.expiry_tick = deadlineTick(task.deadline);
+    task.sequence = static_cast<uint64_t>(periods);
+
+    TaskStats stats;
+    stats.name = name;
+    stats.period = period;
+
+    int task_id = static_cast<int>(tasks_.size());
+    tasks_.push_back(std::move(task));
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        stats_.push_back(stats);
+    }
+    insert(task_id);
+    return task_id;
+}
+
+void Scheduler::run(const std::atomic<bool>& running) {
+    std::vector<int> woken;
+    while (running.load()) {
+        poll(Clock::now());
+
+        for (int task_id : woken) {
+            fireWoken(task_id);
+        }
+        woken.clear();
+
+        auto wakeup = nextWakeup();
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        wait_cv_.wait_until(lock, wakeup, [this] { return stop_requested_ || !woken_.empty(); });
+        if (stop_requested_) {
+            break;
+        }
+        woken.swap(woken_);
+    }
+}
+
+void Scheduler::stop() {
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        stop_requested_ = true;
+    }
+    wait_cv_.notify_all();
+}
+
+void Scheduler::wake(int task_id) {
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        // 아직 처리 안 된 같은 요청은 한 번으로 합친다
+        if (std::find(woken_.begin(), woken_.end(), task_id) == woken_.end()) {
+            woken_.push_back(task_id);
+        }
+    }
+    wait_cv_.notify_all();
+}
+
+int Scheduler::poll(Clock::time_point now) {
+    int fired = 0;
+    uint64_t target = tickOf(now);
+
+    while (current_tick_ <= target) {
+        uint64_t tick = current_tick_;
+
+        // 상위 레벨부터 하위 레벨로 내려보낸다
+        for (int level = kLevels - 1; level > 0; --level) {
+            uint64_t span_mask = (1ull << (kSlotBits * level)) - 1;
+            if ((tick & span_mask) == 0) {
+                cascade(level);
+            }
+        }
+
+        auto& slot = wheel_[0][tick & kSlotMask];
+        if (!slot.empty()) {
+            scratch_.swap(slot);
+            // 같은 틱의 작업은 등록 순서대로 실행
+            std::sort(scratch_.begin(), scratch_.end());
+            for (int task_id : scratch_) {
+                if (tasks_[task_id].expiry_tick <= tick) {
+                    fire(task_id);
+                    ++fired;
+                }
+                insert(task_id);
+            }
+            scratch_.clear();
+        }
+
+        ++current_tick_;
+    }
+
+    return fired;
+}
+
+Scheduler::Clock::time_point Scheduler::nextWakeup() const {
+    // 레벨 0에서 다음 비어있지 않은 슬롯, 없으면 다음 캐스케이드 경계
+    uint64_t boundary = (current_tick_ | kSlotMask) + 1;
+    if ((current_tick_ & kSlotMask) == 0) {
+        boundary = current_tick_;
+    }
+
+    for (uint64_t tick = current_tick_; tick < boundary; ++tick) {
+        if (!wheel_[0][tick & kSlotMask].empty()) {
+            return origin_ + resolution_ * tick;
+        }
+    }
+    return origin_ + resolution_ * boundary;
+}
+
+std::vector<TaskStats> Scheduler::getStats() const {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    return stats_;
+}
+
+uint64_t Scheduler::tickOf(Clock::time_point tp) const {
+    if (tp <= origin_) {
+        return 0;
+    }
+    return static_cast<uint64_t>((tp - origin_) / resolution_);
+}
+
+uint64_t Scheduler::deadlineTick(Clock::time_point deadline) const {
+    if (deadline <= origin_) {
+        return 0;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - origin_);
+    auto res = std::chrono::duration_cast<std::chrono::nanoseconds>(resolution_);
+    return static_cast<uint64_t>((elapsed.count() + res.count() - 1) / res.count());
+}
+
+void Scheduler::insert(int task_id) {
+    auto& task = tasks_[task_id];
+    uint64_t expiry = std::max(task.expiry_tick, current_tick_);
+    uint64_t delta = expiry - current_tick_;
+
+    int level = 0;
+    while (level < kLevels - 1 && delta >= (1ull << (kSlotBits * (level + 1)))) {
+        ++level;
+    }
+
+    uint64_t index = (expiry >> (kSlotBits * level)) & kSlotMask;
+    wheel_[level][index].push_back(task_id);
+}
+
+void Scheduler::cascade(int level) {
+    uint64_t index = (current_tick_ >> (kSlotBits * level)) & kSlotMask;
+    auto& slot = wheel_[level][index];
+    if (slot.empty()) {
+        return;
+    }
+
+    scratch_.swap(slot);
+    for (int task_id : scratch_) {
+        insert(task_id);
+    }
+    scratch_.clear();
+}
+
+void Scheduler::fire(int task_id) {
+    TickInfo info;
+    info.deadline = tasks_[task_id].deadline;
+    info.fired_at = Clock::now();
+    info.lateness = std::chrono::duration_cast<std::chrono::microseconds>(info.fired_at - info.deadline);
+    info.sequence = tasks_[task_id].sequence;
+
+    try {
+        tasks_[task_id].callback(info);
+    } catch (const std::exception& e) {
+        std::cerr << "스케줄 작업 오류 (" << tasks_[task_id].name << "): " << e.what() << std::endl;
+    }
+
+    // 콜백에서 addTask가 호출될 수 있으므로 참조는 콜백 이후에 얻는다
+    auto& task = tasks_[task_id];
+
+    // 다음 마감은 이전 마감 기준 (드리프트 없음), 이미 지난 주기는 건너뜀
+    uint64_t missed = 0;
+    task.deadline += task.period;
+    ++task.sequence;
+    auto after = Clock::now();
+    if (task.deadline <= after) {
+        missed = static_cast<uint64_t>((after - task.deadline) / task.period) + 1;
+        task.deadline += task.period * missed;
+        task.sequence += missed;
+    }
+    task.expiry_tick = deadlineTick(task.deadline);
+
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    auto& stats = stats_[task_id];
+    ++stats.fired;
+    stats.skipped += missed;
+    stats.last_lateness = info.lateness;
+    stats.max_lateness = std::max(stats.max_lateness, info.lateness);
+    stats.avg_lateness_us += (static_cast<double>(info.lateness.count()) - stats.avg_lateness_us) /
+                             static_cast<double>(stats.fired);
+}
+
+void Scheduler::fireWoken(int task_id) {
+    if (task_id < 0 || task_id >= static_cast<int>(tasks_.size())) {
+        return;
+    }
+
+    // 주기 밖 실행: 마감 = 지금, 다음 주기 마감과 sequence는 건드리지 않는다
+    TickInfo info;
+    info.fired_at = Clock::now();
+    info.deadline = info.fired_at;
+    info.sequence = tasks_[task_id].sequence;
+    info.woken = true;
+
+    try {
+        tasks_[task_id].callback(info);
+    } catch (const std::exception& e) {
+        std::cerr << "스케줄 작업 오류 (" << tasks_[task_id].name << "): " << e.what() << std::endl;
+    }
+
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    ++stats_[task_id].woken;
+}
+
+} // namespace core
@@ -0,0 +1,108 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace core {
+
+// 틱 실행 정보 (콜백에 전달)
+struct TickInfo {
+    std::chrono::steady_clock::time_point deadline;   // 예정된 절대 마감 시각
+    std::chrono::steady_clock::time_point fired_at;   // 실제 실행 시각
+    std::chrono::microseconds lateness{0};            // 지연 = fired_at - deadline
+    uint64_t sequence{0};                             // 주기 번호 (건너뛴 주기 포함)
+    bool woken{false};                                // wake()로 주기 밖에서 실행됨
+};
+
+// 작업별 통계
+struct TaskStats {
+    std::string name;
+    std::chrono::milliseconds period{0};
+    uint64_t fired{0};                                // 실행 횟수
+    uint64_t skipped{0};                              // 마감 초과로 건너뛴 주기 수
+    uint64_t woken{0};                                // wake()로 추가 실행된 횟수
+    std::chrono::microseconds last_lateness{0};
+    std::chrono::microseconds max_lateness{0};
+    double avg_lateness_us{0.0};
+};
+
+// steady_clock 절대 마감 기반 계층형 타이머 휠
+// 다음 마감 = 이전 마감 + 주기 이므로 수집 시간이 길어져도 시간축이 밀리지 않는다.
+class Scheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Callback = std::function<void(const TickInfo&)>;
+
+    // origin을 공유하면 여러 스케줄러(스레드)가 같은 시간축의 주기 경계를 사용한다
+    explicit Scheduler(Clock::time_point origin = Clock::now(),
+                       std::chrono::microseconds resolution = std::chrono::milliseconds(1));
+    ~Scheduler() = default;
+
+    // 주기 작업 등록 (첫 실행은 다음 주기 경계), 작업 ID 반환
+    int addTask(const std::string& name, std::chrono::milliseconds period, Callback callback);
+
+    // running이 false가 되거나 stop() 호출 시까지 실행
+    void run(const std::atomic<bool>& running);
+    void stop();
+
+    // 작업을 다음 마감을 기다리지 않고 run() 스레드에서 한 번 더 실행 (다른 스레드에서 호출 가능)
+    // 주기 마감은 그대로 유지된다.
+    void wake(int task_id);
+
+    // 현재 시각까지 만료된 작업 실행 (대기 없음), 실행된 작업 수 반환
+    int poll(Clock::time_point now);
+
+    // 다음으로 깨어나야 하는 시각
+    Clock::time_point nextWakeup() const;
+
+    std::vector<TaskStats> getStats() const;
+
+private:
+    Scheduler(const Scheduler&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
+
+    static constexpr int kLevels = 4;
+    static constexpr int kSlotBits = 6;
+    static constexpr uint64_t kSlots = 1ull << kSlotBits;
+    static constexpr uint64_t kSlotMask = kSlots - 1;
+
+    struct Task {
+        std::string name;
+        std::chrono::milliseconds period;
+        Callback callback;
+        Clock::time_point deadline;
+        uint64_t expiry_tick{0};
+        uint64_t sequence{0};
+    };
+
+    uint64_t tickOf(Clock::time_point tp) const;
+    uint64_t deadlineTick(Clock::time_point deadline) const;
+    void insert(int task_id);
+    void cascade(int level);
+    void fire(int task_id);
+    void fireWoken(int task_id);
+
+    const Clock::time_point origin_;
+    const std::chrono::microseconds resolution_;
+    uint64_t current_tick_{0};   // 다음에 처리할 틱
+
+    std::vector<Task> tasks_;
+    std::array<std::array<std::vector<int>, kSlots>, kLevels> wheel_;
+    std::vector<int> scratch_;
+
+    mutable std::mutex stats_mutex_;
+    std::vector<TaskStats> stats_;
+
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+    bool stop_requested_{false};
+    std::vector<int> woken_;     // wait_mutex_ 보호
+};
+
+} // namespace core
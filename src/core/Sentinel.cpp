@@ -33,6 +33,21 @@ void Sentinel::tickAndEmitMetrics(){
     // OBS 프로세스 모니터링 추가
     systemMonitor.addProcess("obs64");
     systemMonitor.addProcess("obs32");
+    systemMonitor.setThreadTopN(5);   // 프레임 드롭 시 인코더/렌더/출력 스레드 구분용
+    systemMonitor.setPerfCounters(true);   // 문맥 전환/CPU 이주 - 다른 프로세스와의 스케줄링 간섭
+
+    // OBS 종료(크래시)는 다음 틱을 기다리지 않고 바로 알린다
+    systemMonitor.startExitWatch([](const ProcExit& exit) {
+      IpcLoop::send({
+        {"event", "process_exit"},
+        {"ts", std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count()},
+        {"name", exit.name},
+        {"pid", exit.pid},
+        {"restarted_pid", exit.restarted_pid},
+        {"via_pidfd", exit.via_pidfd}
+      });
+    });
     
     // OBS WebSocket 연결 시도
     if (obsClient.connect("ws://localhost:4444")) {
@@ -79,9 +94,39 @@ void Sentinel::tickAndEmitMetrics(){
   auto systemMetrics = systemMonitor.getSystemMetrics();
   
   // 네트워크 메트릭 수집
-  auto network_metrics = networkProbe.getMetrics();
-  double rtt = network_metrics["rtt_ms"];
-  double loss = network_metrics["loss_pct"];
+  core::MetricFrame network_metrics;
+  networkProbe.collect(network_metrics);
+  double rtt = network_metrics[core::MetricId::RttMs];
+  double loss = network_metrics[core::MetricId::LossPct];
+  double rtt_min = network_metrics[core::MetricId::RttMinMs];
+  double jitter = network_metrics[core::MetricId::JitterMs];
+  
+  // 호스트별 RTT (이번 라운드에 응답하지 않은 호스트는 null) + 최근 60초 분포
+  json rtt_hosts = json::array();
+  auto hosts = networkProbe.getHostRtts();
+  for (size_t i = 0; i < hosts.size(); ++i) {
+    const auto& host = hosts[i];
+    const auto& histogram = networkProbe.getRttHistogram(i);
+    auto percentiles = histogram.getPercentiles();
+    rtt_hosts.push_back({{"host", host.name},
+                         {"p50", percentiles.p50},
+                         {"p90", percentiles.p90},
+                         {"p99", percentiles.p99},
+                         {"p999", percentiles.p999},
+                         {"samples", histogram.getTotalCount()},
+                         {"hist", histogram.encode()},
+                         {"rtt_ms", host.replied ? json(host.rtt_ms) : json(nullptr)},
+                         {"user_rtt_ms", host.replied ? json(host.user_rtt_ms) : json(nullptr)},
+                         {"kernel_rtt_ms", host.kernel_timestamped ? json(host.kernel_rtt_ms) : json(nullptr)},
+                         {"jitter_ms", host.jitter_ms},
+                         {"seq", host.seq},
+                         {"timeouts", host.timeouts},
+                         {"loss_pct", host.loss.loss_pct},
+                         {"max_burst", host.loss.max_burst},
+                         {"longest_burst", host.loss.longest_burst},
+                         {"reordered", host.loss.reordered},
+                         {"duplicates", host.loss.duplicates}});
+  }
   
   // 실제 대역폭 측정 (최근 측정값 사용)
   static BandwidthTest bandwidthTest;
@@ -105,11 +150,56 @@ void Sentinel::tickAndEmitMetrics(){
   // OBS 통계 수집
   auto obsStats = obsClient.getStats();
   
+  // OBS 프로세스 자체의 CPU/메모리 (시스템 cpu_pct와 같은 기준)
+  double obs_cpu_pct = 0.0;
+  double obs_mem_mb = 0.0;
+  int obs_threads = 0;
+  double obs_ctx_switches = 0.0;
+  double obs_migrations = 0.0;
+  double obs_page_faults = 0.0;
+  bool obs_io_active = false;
+  double obs_read_bps = 0.0;
+  double obs_write_bps = 0.0;
+  double obs_read_syscalls = 0.0;
+  double obs_write_syscalls = 0.0;
+  uint64_t obs_cancelled_write_bytes = 0;
+  json obs_top_threads = json::array();
+  for (const auto& proc : systemMonitor.getProcessStats()) {
+    if (!proc.running) continue;
+    obs_cpu_pct += proc.cpu_pct;
+    obs_mem_mb += proc.mem_mb;
+    obs_threads += proc.threads;
+    obs_ctx_switches += proc.context_switches_per_sec;
+    obs_migrations += proc.cpu_migrations_per_sec;
+    obs_page_faults += proc.page_faults_per_sec;
+    if (proc.io_active) {
+      obs_io_active = true;
+      obs_read_bps += proc.read_bytes_per_sec;
+      obs_write_bps += proc.write_bytes_per_sec;
+      obs_read_syscalls += proc.read_syscalls_per_sec;
+      obs_write_syscalls += proc.write_syscalls_per_sec;
+      obs_cancelled_write_bytes += proc.cancelled_write_bytes;
+    }
+    for (const auto& thread : proc.top_threads) {
+      obs_top_threads.push_back({{"tid", thread.tid}, {"name", thread.name}, {"cpu_pct", thread.cpu_pct}});
+    }
+  }
+  
   json m = {
     {"event","metrics"},
     {"ts", std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::system_clock::now().time_since_epoch()).count()},
     {"rtt_ms", rtt},
+    {"rtt_min_ms", rtt_min},
+    {"jitter_ms", jitter},
+    {"rtt", {
+      {"p50", network_metrics[core::MetricId::RttP50Ms]},
+      {"p90", network_metrics[core::MetricId::RttP90Ms]},
+      {"p99", network_metrics[core::MetricId::RttP99Ms]},
+      {"p999", network_metrics[core::MetricId::RttP999Ms]},
+      {"hist", networkProbe.getRttHistogram().encode()}
+    }},
+    {"rtt_hosts", rtt_hosts},
     {"loss_pct", loss},
     {"uplink_kbps", uplink_kbps},
     {"cpu_pct", systemMetrics.cpu_pct},
@@ -121,7 +211,20 @@ void Sentinel::tickAndEmitMetrics(){
       {"render_lag_ms", obsStats.render_lag_ms},
       {"streaming", obsStats.streaming},
       {"recording", obsStats.recording},
-      {"current_scene", obsStats.current_scene}
+      {"current_scene", obsStats.current_scene},
+      {"cpu_pct", obs_cpu_pct},
+      {"mem_mb", obs_mem_mb},
+      {"threads", obs_threads},
+      {"ctx_switches_per_sec", obs_ctx_switches},
+      {"cpu_migrations_per_sec", obs_migrations},
+      {"page_faults_per_sec", obs_page_faults},
+      {"io_active", obs_io_active},
+      {"read_bytes_per_sec", obs_read_bps},
+      {"write_bytes_per_sec", obs_write_bps},
+      {"read_syscalls_per_sec", obs_read_syscalls},
+      {"write_syscalls_per_sec", obs_write_syscalls},
+      {"cancelled_write_bytes", obs_cancelled_write_bytes},
+      {"top_threads", obs_top_threads}
     }}
   };
   
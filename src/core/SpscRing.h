@@ -0,0 +1,64 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace core {
+
+// 단일 생산자/단일 소비자 lock-free 링 버퍼
+// 생산자와 소비자 인덱스를 서로 다른 캐시 라인에 두어 false sharing을 피한다.
+template <typename T, size_t Capacity>
+class SpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "SpscRing capacity must be a power of two");
+
+public:
+    // 생산자 스레드 전용 - 가득 차면 false (샘플은 버려짐)
+    bool push(const T& item) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head - cached_tail_ == Capacity) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head - cached_tail_ == Capacity) {
+                return false;
+            }
+        }
+        buffer_[head & kMask] = item;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 소비자 스레드 전용 - 비어 있으면 false
+    bool pop(T& out) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == cached_head_) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail == cached_head_) {
+                return false;
+            }
+        }
+        out = buffer_[tail & kMask];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t size() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    static constexpr size_t kMask = Capacity - 1;
+
+    // 생산자 캐시 라인
+    alignas(64) std::atomic<size_t> head_{0};
+    size_t cached_tail_{0};
+
+    // 소비자 캐시 라인
+    alignas(64) std::atomic<size_t> tail_{0};
+    size_t cached_head_{0};
+
+    alignas(64) std::array<T, Capacity> buffer_{};
+};
+
+} // namespace core
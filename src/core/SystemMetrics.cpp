@@ -6,14 +6,16 @@
 #include <sstream>
 #include <cstdlib>
 #include <ctime>
+#include <mutex>
+#include <algorithm>
 
 #ifdef _WIN32
 #include <windows.h>
 #include <pdh.h>
 #pragma comment(lib, "pdh.lib")
 #else
-#include <sys/sysinfo.h>
 #include <sys/statvfs.h>
+#include "../sys/MemInfo.h"
 #endif
 
 namespace core {
@@ -43,29 +45,54 @@ public:
 #endif
     }
     
-    std::map<std::string, double> getMetrics() {
-        std::map<std::string, double> metrics;
-        
-        metrics["cpu_pct"] = getCpuUsage();
-        metrics["memory_pct"] = getMemoryUsage();
-        metrics["memory_mb"] = getMemoryMB();
-        metrics["gpu_pct"] = getGpuUsage();
-        metrics["disk_pct"] = getDiskUsage();
-        
-        return metrics;
+    void collect(MetricFrame& frame) {
+        auto cpu = getCpuBreakdown();
+        frame[MetricId::CpuPct] = cpu.total_pct;
+        frame[MetricId::CpuUserPct] = cpu.user_pct;
+        frame[MetricId::CpuSystemPct] = cpu.system_pct;
+        frame[MetricId::CpuIowaitPct] = cpu.iowait_pct;
+        frame[MetricId::CpuStealPct] = cpu.steal_pct;
+        frame[MetricId::MemoryPct] = getMemoryUsage();
+        frame[MetricId::MemMb] = getMemoryMB();
+        frame[MetricId::GpuPct] = getGpuUsage();
+        frame[MetricId::DiskPct] = getDiskUsage();
+        getCoreLoad(frame.cores);
     }
     
     double getCpuUsage() {
+        return getCpuBreakdown().total_pct;
+    }
+    
+    sys::CpuUsage getCpuBreakdown() {
 #ifdef _WIN32
         PDH_FMT_COUNTERVALUE counterVal;
         
         PdhCollectQueryData(cpu_query_);
         PdhGetFormattedCounterValue(cpu_counter_, PDH_FMT_DOUBLE, nullptr, &counterVal);
         
-        return counterVal.doubleValue;
+        sys::CpuUsage usage;
+        usage.total_pct = counterVal.doubleValue;
+        return usage;
 #else
         // Linux/Unix 시스템에서는 /proc/stat을 읽어서 계산
-        return getCpuUsageLinux();
+        std::lock_guard<std::mutex> lock(cpu_mutex_);
+        cpu_sampler_.sample();
+        return cpu_sampler_.getTotal();
+#endif
+    }
+    
+    void getCoreLoad(CoreLoad& load) {
+#ifdef _WIN32
+        load.count = 0;
+#else
+        // 샘플은 getCpuBreakdown()에서 갱신 - 여기서는 마지막 결과만 양자화
+        std::lock_guard<std::mutex> lock(cpu_mutex_);
+        const auto& cores = cpu_sampler_.getCores();
+        size_t count = cpu_sampler_.isValid() ? std::min(cores.size(), CoreLoad::kMaxCores) : 0;
+        load.count = static_cast<uint16_t>(count);
+        CoreLoad::quantize(cores.busy_pct.data(), load.busy.data(), count);
+        CoreLoad::quantize(cores.iowait_pct.data(), load.iowait.data(), count);
+        CoreLoad::quantize(cores.steal_pct.data(), load.steal.data(), count);
 #endif
     }
     
@@ -77,11 +104,10 @@ public:
         
         return static_cast<double>(memInfo.dwMemoryLoad);
 #else
-        struct sysinfo si;
-        if (sysinfo(&si) == 0) {
-            unsigned long total = si.totalram * si.mem_unit;
-            unsigned long free = si.freeram * si.mem_unit;
-            return static_cast<double>(total - free) / total * 100.0;
+        // free만 빼면 회수 가능한 페이지 캐시까지 사용 중으로 잡힌다 - MemAvailable 기준
+        sys::MemInfo info;
+        if (readMemInfo(info) && info.total_kb > 0) {
+            return static_cast<double>(info.usedKb()) / static_cast<double>(info.total_kb) * 100.0;
         }
         return 0.0;
 #endif
@@ -95,10 +121,9 @@ public:
         
         return static_cast<double>(memInfo.ullTotalPhys - memInfo.ullAvailPhys) / (1024 * 1024);
 #else
-        struct sysinfo si;
-        if (sysinfo(&si) == 0) {
-            unsigned long used = (si.totalram - si.freeram) * si.mem_unit;
-            return static_cast<double>(used) / (1024 * 1024);
+        sys::MemInfo info;
+        if (readMemInfo(info)) {
+            return static_cast<double>(info.usedKb()) / 1024.0;
         }
         return 0.0;
 #endif
@@ -143,22 +168,25 @@ public:
     }
     
 private:
+    // 랜덤 시드 초기화
+    bool rand_initialized_{false};
+    
 #ifdef _WIN32
     PDH_HQUERY cpu_query_{nullptr};
     PDH_HCOUNTER cpu_counter_{nullptr};
     ULONGLONG total_memory_{0};
+#else
+    // /proc/stat을 열어둔 채 재사용 (getGpuUsage 시뮬레이션도 같은 값을 참조)
+    std::mutex cpu_mutex_;
+    sys::CpuSampler cpu_sampler_;
     
-    // 랜덤 시드 초기화
-    bool rand_initialized_{false};
+    // /proc/meminfo도 열어둔 채 재사용
+    std::mutex mem_mutex_;
+    sys::MemInfoReader mem_reader_;
     
-    double getCpuUsageLinux() {
-        // Linux CPU 사용률 계산 (간단한 구현)
-        return 0.0;
-    }
-#else
-    double getCpuUsageLinux() {
-        // Linux CPU 사용률 계산 (간단한 구현)
-        return 0.0;
+    bool readMemInfo(sys::MemInfo& info) {
+        std::lock_guard<std::mutex> lock(mem_mutex_);
+        return mem_reader_.read(info);
     }
 #endif
 };
@@ -173,18 +201,34 @@ SystemMetrics::SystemMetrics() : impl_(std::make_unique<SystemMetricsImpl>()) {}
 
 SystemMetrics::~SystemMetrics() = default;
 
-std::map<std::string, double> SystemMetrics::getMetrics() {
-    return impl_->getMetrics();
+void SystemMetrics::collect(MetricFrame& frame) {
+    impl_->collect(frame);
 }
 
 double SystemMetrics::getCpuUsage() {
     return impl_->getCpuUsage();
 }
 
+sys::CpuUsage SystemMetrics::getCpuBreakdown() {
+    return impl_->getCpuBreakdown();
+}
+
+void SystemMetrics::getCoreLoad(CoreLoad& load) {
+    impl_->getCoreLoad(load);
+}
+
 double SystemMetrics::getMemoryUsage() {
     return impl_->getMemoryUsage();
 }
 
+double SystemMetrics::getMemoryMB() {
+    return impl_->getMemoryMB();
+}
+
+double SystemMetrics::getGpuUsage() {
+    return impl_->getGpuUsage();
+}
+
 double SystemMetrics::getDiskUsage() {
     return impl_->getDiskUsage();
 }
@@ -1,7 +1,9 @@
 #pragma once
 #include <string>
-#include <map>
 #include <memory>
+#include <vector>
+#include "MetricRegistry.h"
+#include "../sys/CpuSampler.h"
 
 namespace core {
 
@@ -12,12 +14,16 @@ public:
     SystemMetrics();
     ~SystemMetrics();
     
-    // 시스템 메트릭 수집
-    std::map<std::string, double> getMetrics();
+    // 시스템/디스크 메트릭을 지정 슬롯에 수집
+    void collect(MetricFrame& frame);
     
     // 개별 메트릭 조회
     double getCpuUsage();
+    sys::CpuUsage getCpuBreakdown();              // 전체 + user/system/iowait/steal
+    void getCoreLoad(CoreLoad& load);             // 마지막 샘플의 코어별 값 (양자화)
     double getMemoryUsage();
+    double getMemoryMB();
+    double getGpuUsage();
     double getDiskUsage();
     
 private:
@@ -0,0 +1,116 @@
+#include "MetricsSerializer.h"
+#include "../core/Base64.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+namespace ipc {
+
+namespace {
+// 필드당 최대 길이: 조각 + 숫자(부호/지수 포함 최대 25자)
+constexpr size_t kMaxNumberChars = 32;
+
+// 코어 배열: 따옴표 + 최대 코어 수의 base64
+constexpr size_t kMaxCoreChars = core::base64Length(core::CoreLoad::kMaxCores) + 2;
+
+constexpr size_t maxLineLength() {
+    size_t total = 2;  // "}\n"
+    for (const auto& field : kMetricsSchema) {
+        total += field.fragment.size() + field.text.size()
+               + (field.kind == FieldSpec::Kind::CoreVector ? kMaxCoreChars : kMaxNumberChars);
+    }
+    return total;
+}
+}
+
+static_assert(maxLineLength() <= MetricsSerializer::kBufferSize, "serializer buffer too small for schema");
+
+nlohmann::json toJson(const core::MetricFrame& frame) {
+    nlohmann::json j = nlohmann::json::object();
+    for (const auto& field : kMetricsSchema) {
+        std::string key(field.key);
+        switch (field.kind) {
+            case FieldSpec::Kind::Real: j[key] = frame[field.metric]; break;
+            case FieldSpec::Kind::Timestamp: j[key] = frame.ts; break;
+            case FieldSpec::Kind::Constant: j[key] = std::string(field.text); break;
+            case FieldSpec::Kind::CoreVector: {
+                size_t count = std::min<size_t>(frame.cores.count, core::CoreLoad::kMaxCores);
+                j[key] = core::base64Encode((frame.cores.*field.cores).data(), count);
+                break;
+            }
+        }
+    }
+    return j;
+}
+
+nlohmann::json schemaFields() {
+    nlohmann::json fields = nlohmann::json::array();
+    for (const auto& field : kMetricsSchema) {
+        if (field.kind == FieldSpec::Kind::CoreVector) {
+            // 코어당 1바이트, 값 x scale = %
+            fields.push_back({{"name", std::string(field.key)}, {"type", "u8b64"},
+                              {"scale", core::CoreLoad::kScale}});
+            continue;
+        }
+        const char* type = field.kind == FieldSpec::Kind::Real ? "float"
+                         : field.kind == FieldSpec::Kind::Timestamp ? "int" : "str";
+        fields.push_back({{"name", std::string(field.key)}, {"type", type}});
+    }
+    return fields;
+}
+
+std::string_view MetricsSerializer::serialize(const core::MetricFrame& frame) {
+    char* out = buffer_.data();
+
+    for (const auto& field : kMetricsSchema) {
+        std::memcpy(out, field.fragment.data(), field.fragment.size());
+        out += field.fragment.size();
+
+        switch (field.kind) {
+            case FieldSpec::Kind::Real:
+                out = writeReal(out, frame[field.metric]);
+                break;
+            case FieldSpec::Kind::Timestamp:
+                out = writeInteger(out, frame.ts);
+                break;
+            case FieldSpec::Kind::Constant:
+                *out++ = '"';
+                std::memcpy(out, field.text.data(), field.text.size());
+                out += field.text.size();
+                *out++ = '"';
+                break;
+            case FieldSpec::Kind::CoreVector:
+                out = writeCores(out, frame.cores, field.cores);
+                break;
+        }
+    }
+
+    *out++ = '}';
+    *out++ = '\n';
+    return std::string_view(buffer_.data(), static_cast<size_t>(out - buffer_.data()));
+}
+
+char* MetricsSerializer::writeReal(char* out, double value) {
+    // dump()와 동일: NaN/inf는 null, 나머지는 같은 Grisu2 포맷터 사용
+    if (!std::isfinite(value)) {
+        std::memcpy(out, "null", 4);
+        return out + 4;
+    }
+    return nlohmann::detail::to_chars(out, out + kMaxNumberChars, value);
+}
+
+char* MetricsSerializer::writeCores(char* out, const core::CoreLoad& load,
+                                     CoreArray core::CoreLoad::* values) {
+    size_t count = std::min<size_t>(load.count, core::CoreLoad::kMaxCores);
+    *out++ = '"';
+    out = core::base64Encode((load.*values).data(), count, out);
+    *out++ = '"';
+    return out;
+}
+
+char* MetricsSerializer::writeInteger(char* out, int64_t value) {
+    return std::to_chars(out, out + kMaxNumberChars, value).ptr;
+}
+
+} // namespace ipc
@@ -0,0 +1,164 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <nlohmann/json.hpp>
+#include "../core/MetricRegistry.h"
+
+namespace ipc {
+
+using CoreArray = std::array<uint8_t, core::CoreLoad::kMaxCores>;
+
+// 스키마 필드: 구분자/키가 미리 합쳐진 조각 + 값 위치
+struct FieldSpec {
+    enum class Kind { Constant, Timestamp, Real, CoreVector };
+
+    std::string_view key;
+    std::string_view fragment;                 // 예: ,"gpu_pct":
+    Kind kind;
+    std::string_view text;                     // Constant 값 (이스케이프 불필요한 문자열)
+    core::MetricId metric{core::MetricId::Count};  // Real 값 슬롯
+    CoreArray core::CoreLoad::* cores{nullptr};    // CoreVector 배열 (count 바이트, base64 문자열)
+};
+
+// nlohmann::json::dump()와 같은 키 순서(사전순)로 정렬된 컴파일 타임 스키마
+// Real 필드의 키는 core::kMetricRegistry 이름과 일치해야 한다.
+inline constexpr std::array<FieldSpec, 65> kMetricsSchema{{
+    {"cgroup_cpu_pct",           "{\"cgroup_cpu_pct\":",           FieldSpec::Kind::Real,       {},        core::MetricId::CgroupCpuPct,          nullptr},
+    {"cgroup_io_iops",           ",\"cgroup_io_iops\":",           FieldSpec::Kind::Real,       {},        core::MetricId::CgroupIoIops,          nullptr},
+    {"cgroup_io_read_mbps",      ",\"cgroup_io_read_mbps\":",      FieldSpec::Kind::Real,       {},        core::MetricId::CgroupIoReadMbps,      nullptr},
+    {"cgroup_io_write_mbps",     ",\"cgroup_io_write_mbps\":",     FieldSpec::Kind::Real,       {},        core::MetricId::CgroupIoWriteMbps,     nullptr},
+    {"cgroup_mem_mb",            ",\"cgroup_mem_mb\":",            FieldSpec::Kind::Real,       {},        core::MetricId::CgroupMemMb,           nullptr},
+    {"cgroup_mem_pct",           ",\"cgroup_mem_pct\":",           FieldSpec::Kind::Real,       {},        core::MetricId::CgroupMemPct,          nullptr},
+    {"cgroup_throttled_pct",     ",\"cgroup_throttled_pct\":",     FieldSpec::Kind::Real,       {},        core::MetricId::CgroupThrottledPct,    nullptr},
+    {"cores_busy",               ",\"cores_busy\":",               FieldSpec::Kind::CoreVector, {},        core::MetricId::Count,                 &core::CoreLoad::busy},
+    {"cores_iowait",             ",\"cores_iowait\":",             FieldSpec::Kind::CoreVector, {},        core::MetricId::Count,                 &core::CoreLoad::iowait},
+    {"cores_net_rx",             ",\"cores_net_rx\":",             FieldSpec::Kind::CoreVector, {},        core::MetricId::Count,                 &core::CoreLoad::net_rx},
+    {"cores_steal",              ",\"cores_steal\":",              FieldSpec::Kind::CoreVector, {},        core::MetricId::Count,                 &core::CoreLoad::steal},
+    {"cpu_iowait_pct",           ",\"cpu_iowait_pct\":",           FieldSpec::Kind::Real,       {},        core::MetricId::CpuIowaitPct,          nullptr},
+    {"cpu_pct",                  ",\"cpu_pct\":",                  FieldSpec::Kind::Real,       {},        core::MetricId::CpuPct,                nullptr},
+    {"cpu_steal_pct",            ",\"cpu_steal_pct\":",            FieldSpec::Kind::Real,       {},        core::MetricId::CpuStealPct,           nullptr},
+    {"cpu_system_pct",           ",\"cpu_system_pct\":",           FieldSpec::Kind::Real,       {},        core::MetricId::CpuSystemPct,          nullptr},
+    {"cpu_user_pct",             ",\"cpu_user_pct\":",             FieldSpec::Kind::Real,       {},        core::MetricId::CpuUserPct,            nullptr},
+    {"ctxt_per_s",               ",\"ctxt_per_s\":",               FieldSpec::Kind::Real,       {},        core::MetricId::CtxtPerSec,            nullptr},
+    {"disk_await_ms",            ",\"disk_await_ms\":",            FieldSpec::Kind::Real,       {},        core::MetricId::DiskAwaitMs,           nullptr},
+    {"disk_iops",                ",\"disk_iops\":",                FieldSpec::Kind::Real,       {},        core::MetricId::DiskIops,              nullptr},
+    {"disk_pct",                 ",\"disk_pct\":",                 FieldSpec::Kind::Real,       {},        core::MetricId::DiskPct,               nullptr},
+    {"disk_queue_depth",         ",\"disk_queue_depth\":",         FieldSpec::Kind::Real,       {},        core::MetricId::DiskQueueDepth,        nullptr},
+    {"disk_read_mbps",           ",\"disk_read_mbps\":",           FieldSpec::Kind::Real,       {},        core::MetricId::DiskReadMbps,          nullptr},
+    {"disk_util_pct",            ",\"disk_util_pct\":",            FieldSpec::Kind::Real,       {},        core::MetricId::DiskUtilPct,           nullptr},
+    {"disk_write_mbps",          ",\"disk_write_mbps\":",          FieldSpec::Kind::Real,       {},        core::MetricId::DiskWriteMbps,         nullptr},
+    {"event",                    ",\"event\":",                    FieldSpec::Kind::Constant,   "metrics", core::MetricId::Count,                 nullptr},
+    {"gpu_pct",                  ",\"gpu_pct\":",                  FieldSpec::Kind::Real,       {},        core::MetricId::GpuPct,                nullptr},
+    {"intr_per_s",               ",\"intr_per_s\":",               FieldSpec::Kind::Real,       {},        core::MetricId::IntrPerSec,            nullptr},
+    {"jitter_ms",                ",\"jitter_ms\":",                FieldSpec::Kind::Real,       {},        core::MetricId::JitterMs,              nullptr},
+    {"loss_burst",               ",\"loss_burst\":",               FieldSpec::Kind::Real,       {},        core::MetricId::LossBurst,             nullptr},
+    {"loss_pct",                 ",\"loss_pct\":",                 FieldSpec::Kind::Real,       {},        core::MetricId::LossPct,               nullptr},
+    {"mem_mb",                   ",\"mem_mb\":",                   FieldSpec::Kind::Real,       {},        core::MetricId::MemMb,                 nullptr},
+    {"memory_pct",               ",\"memory_pct\":",               FieldSpec::Kind::Real,       {},        core::MetricId::MemoryPct,             nullptr},
+    {"net_drops_per_s",          ",\"net_drops_per_s\":",          FieldSpec::Kind::Real,       {},        core::MetricId::NetDropsPerSec,        nullptr},
+    {"net_errors_per_s",         ",\"net_errors_per_s\":",         FieldSpec::Kind::Real,       {},        core::MetricId::NetErrorsPerSec,       nullptr},
+    {"net_rx_kbps",              ",\"net_rx_kbps\":",              FieldSpec::Kind::Real,       {},        core::MetricId::NetRxKbps,             nullptr},
+    {"net_rx_pps",               ",\"net_rx_pps\":",               FieldSpec::Kind::Real,       {},        core::MetricId::NetRxPps,              nullptr},
+    {"net_tx_pps",               ",\"net_tx_pps\":",               FieldSpec::Kind::Real,       {},        core::MetricId::NetTxPps,              nullptr},
+    {"psi_cpu_full_avg10",       ",\"psi_cpu_full_avg10\":",       FieldSpec::Kind::Real,       {},        core::MetricId::PsiCpuFullAvg10,       nullptr},
+    {"psi_cpu_full_us",          ",\"psi_cpu_full_us\":",          FieldSpec::Kind::Real,       {},        core::MetricId::PsiCpuFullUs,          nullptr},
+    {"psi_cpu_some_avg10",       ",\"psi_cpu_some_avg10\":",       FieldSpec::Kind::Real,       {},        core::MetricId::PsiCpuSomeAvg10,       nullptr},
+    {"psi_cpu_some_us",          ",\"psi_cpu_some_us\":",          FieldSpec::Kind::Real,       {},        core::MetricId::PsiCpuSomeUs,          nullptr},
+    {"psi_io_full_avg10",        ",\"psi_io_full_avg10\":",        FieldSpec::Kind::Real,       {},        core::MetricId::PsiIoFullAvg10,        nullptr},
+    {"psi_io_full_us",           ",\"psi_io_full_us\":",           FieldSpec::Kind::Real,       {},        core::MetricId::PsiIoFullUs,           nullptr},
+    {"psi_io_some_avg10",        ",\"psi_io_some_avg10\":",        FieldSpec::Kind::Real,       {},        core::MetricId::PsiIoSomeAvg10,        nullptr},
+    {"psi_io_some_us",           ",\"psi_io_some_us\":",           FieldSpec::Kind::Real,       {},        core::MetricId::PsiIoSomeUs,           nullptr},
+    {"psi_mem_full_avg10",       ",\"psi_mem_full_avg10\":",       FieldSpec::Kind::Real,       {},        core::MetricId::PsiMemFullAvg10,       nullptr},
+    {"psi_mem_full_us",          ",\"psi_mem_full_us\":",          FieldSpec::Kind::Real,       {},        core::MetricId::PsiMemFullUs,          nullptr},
+    {"psi_mem_some_avg10",       ",\"psi_mem_some_avg10\":",       FieldSpec::Kind::Real,       {},        core::MetricId::PsiMemSomeAvg10,       nullptr},
+    {"psi_mem_some_us",          ",\"psi_mem_some_us\":",          FieldSpec::Kind::Real,       {},        core::MetricId::PsiMemSomeUs,          nullptr},
+    {"rtt_host_delay_ms",        ",\"rtt_host_delay_ms\":",        FieldSpec::Kind::Real,       {},        core::MetricId::RttHostDelayMs,        nullptr},
+    {"rtt_kernel_ms",            ",\"rtt_kernel_ms\":",            FieldSpec::Kind::Real,       {},        core::MetricId::RttKernelMs,           nullptr},
+    {"rtt_min_ms",               ",\"rtt_min_ms\":",               FieldSpec::Kind::Real,       {},        core::MetricId::RttMinMs,              nullptr},
+    {"rtt_ms",                   ",\"rtt_ms\":",                   FieldSpec::Kind::Real,       {},        core::MetricId::RttMs,                 nullptr},
+    {"rtt_p50_ms",               ",\"rtt_p50_ms\":",               FieldSpec::Kind::Real,       {},        core::MetricId::RttP50Ms,              nullptr},
+    {"rtt_p90_ms",               ",\"rtt_p90_ms\":",               FieldSpec::Kind::Real,       {},        core::MetricId::RttP90Ms,              nullptr},
+    {"rtt_p999_ms",              ",\"rtt_p999_ms\":",              FieldSpec::Kind::Real,       {},        core::MetricId::RttP999Ms,             nullptr},
+    {"rtt_p99_ms",               ",\"rtt_p99_ms\":",               FieldSpec::Kind::Real,       {},        core::MetricId::RttP99Ms,              nullptr},
+    {"rtt_user_ms",              ",\"rtt_user_ms\":",              FieldSpec::Kind::Real,       {},        core::MetricId::RttUserMs,             nullptr},
+    {"softirq_net_rx_max_core",  ",\"softirq_net_rx_max_core\":",  FieldSpec::Kind::Real,       {},        core::MetricId::SoftirqNetRxMaxCore,   nullptr},
+    {"softirq_net_rx_max_per_s", ",\"softirq_net_rx_max_per_s\":", FieldSpec::Kind::Real,       {},        core::MetricId::SoftirqNetRxMaxPerSec, nullptr},
+    {"softirq_net_rx_per_s",     ",\"softirq_net_rx_per_s\":",     FieldSpec::Kind::Real,       {},        core::MetricId::SoftirqNetRxPerSec,    nullptr},
+    {"softirq_per_s",            ",\"softirq_per_s\":",            FieldSpec::Kind::Real,       {},        core::MetricId::SoftirqPerSec,         nullptr},
+    {"tick_late_ms",             ",\"tick_late_ms\":",             FieldSpec::Kind::Real,       {},        core::MetricId::TickLateMs,            nullptr},
+    {"ts",                       ",\"ts\":",                       FieldSpec::Kind::Timestamp,  {},        core::MetricId::Count,                 nullptr},
+    {"uplink_kbps",              ",\"uplink_kbps\":",              FieldSpec::Kind::Real,       {},        core::MetricId::UplinkKbps,            nullptr},
+}};
+
+namespace detail {
+constexpr bool isSchemaSorted() {
+    for (size_t i = 1; i < kMetricsSchema.size(); ++i) {
+        if (!(kMetricsSchema[i - 1].key < kMetricsSchema[i].key)) return false;
+    }
+    return true;
+}
+
+// 조각은 반드시 {"key": 또는 ,"key": 형태여야 한다
+constexpr bool fragmentsMatchKeys() {
+    for (size_t i = 0; i < kMetricsSchema.size(); ++i) {
+        const auto& field = kMetricsSchema[i];
+        if (field.fragment.size() != field.key.size() + 4) return false;
+        if (field.fragment[0] != (i == 0 ? '{' : ',') || field.fragment[1] != '"') return false;
+        if (field.fragment.substr(2, field.key.size()) != field.key) return false;
+        if (field.fragment.substr(2 + field.key.size()) != "\":") return false;
+    }
+    return true;
+}
+
+constexpr bool keysMatchRegistry() {
+    for (const auto& field : kMetricsSchema) {
+        if (field.kind == FieldSpec::Kind::Real && core::metricKey(field.metric) != field.key) return false;
+        if ((field.kind == FieldSpec::Kind::CoreVector) != (field.cores != nullptr)) return false;
+    }
+    return true;
+}
+
+// 레지스트리의 모든 메트릭이 Real 필드로 정확히 한 번씩 실려야 한다 (빠진 값은 출력에서 조용히 사라짐)
+constexpr bool schemaCoversRegistry() {
+    for (const auto& info : core::kMetricRegistry) {
+        size_t count = 0;
+        for (const auto& field : kMetricsSchema) {
+            if (field.kind == FieldSpec::Kind::Real && field.metric == info.id) ++count;
+        }
+        if (count != 1) return false;
+    }
+    return true;
+}
+} // namespace detail
+
+static_assert(detail::isSchemaSorted(), "kMetricsSchema keys must be sorted like nlohmann::json objects");
+static_assert(detail::fragmentsMatchKeys(), "kMetricsSchema fragments must match their keys");
+static_assert(detail::keysMatchRegistry(), "kMetricsSchema keys must match core::kMetricRegistry");
+static_assert(detail::schemaCoversRegistry(), "kMetricsSchema must carry every core::MetricId exactly once");
+
+// 바이너리 IPC 등 DOM이 필요한 경로용 (할당 발생)
+nlohmann::json toJson(const core::MetricFrame& frame);
+
+// 핸드셰이크용 필드 목록 [{name, type}] - CoreVector는 "u8b64" + scale
+nlohmann::json schemaFields();
+
+// 재사용 버퍼에 metrics JSONL 한 줄을 직접 기록 (힙 할당 없음)
+// 출력은 nlohmann::json::dump() + "\n"과 바이트 단위로 동일하다.
+class MetricsSerializer {
+public:
+    static constexpr size_t kBufferSize = 8192;
+
+    // 반환된 view는 다음 serialize() 호출 전까지 유효
+    std::string_view serialize(const core::MetricFrame& frame);
+
+private:
+    char* writeReal(char* out, double value);
+    char* writeInteger(char* out, int64_t value);
+    char* writeCores(char* out, const core::CoreLoad& load, CoreArray core::CoreLoad::* values);
+
+    std::array<char, kBufferSize> buffer_;
+};
+
+} // namespace ipc
@@ -0,0 +1,148 @@
+#include "OutputChannel.h"
+#include <cerrno>
+#include <cstdio>
+#include <iostream>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace ipc {
+
+namespace {
+constexpr int kSchemaVersion = 1;
+constexpr size_t kHeaderSize = 4;
+}
+
+bool parseIpcFormat(const std::string& name, IpcFormat& format) {
+    if (name == "jsonl" || name == "json") {
+        format = IpcFormat::Jsonl;
+    } else if (name == "msgpack") {
+        format = IpcFormat::MsgPack;
+    } else if (name == "cbor") {
+        format = IpcFormat::Cbor;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+const char* ipcFormatName(IpcFormat format) {
+    switch (format) {
+        case IpcFormat::MsgPack: return "msgpack";
+        case IpcFormat::Cbor: return "cbor";
+        default: return "jsonl";
+    }
+}
+
+OutputChannel& OutputChannel::getInstance() {
+    static OutputChannel instance;
+    return instance;
+}
+
+void OutputChannel::setFormat(IpcFormat format) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    format_ = format;
+    
+#ifdef _WIN32
+    // 바이너리 프레임이 \n -> \r\n 변환되지 않도록
+    if (format_ != IpcFormat::Jsonl) {
+        _setmode(_fileno(stdout), _O_BINARY);
+    }
+#endif
+}
+
+void OutputChannel::sendHandshake(const nlohmann::json& fields) {
+    nlohmann::json schema = {
+        {"event", "schema"},
+        {"version", kSchemaVersion},
+        {"format", ipcFormatName(format_)},
+        {"framing", isBinary() ? "u32le" : "line"},
+        {"fields", fields}
+    };
+    if (shm_) {
+        schema["shm"] = {
+            {"path", shm_->getPath()},
+            {"capacity", shm_->getCapacity()},
+            {"record_size", shm_->getRecordSize()}
+        };
+    }
+    send(schema);
+}
+
+void OutputChannel::send(const nlohmann::json& message) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (format_ == IpcFormat::Jsonl) {
+        std::cout << message.dump() << "\n";  // 개행으로 라인 경계 보장
+        return;
+    }
+    
+    writeFrame(message);
+}
+
+void OutputChannel::sendMetrics(const core::MetricFrame& frame) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (shm_) {
+        shm_->publish(frame);
+        return;
+    }
+    
+    if (format_ == IpcFormat::Jsonl) {
+        // 고정 스키마로 재사용 버퍼에 직접 기록 - 틱당 힙 할당 없음
+        auto text = serializer_.serialize(frame);
+        std::cout.write(text.data(), static_cast<std::streamsize>(text.size()));
+        return;
+    }
+    
+    writeFrame(toJson(frame));
+}
+
+void OutputChannel::attachShm(ShmRing* ring) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shm_ = (ring && ring->isOpen()) ? ring : nullptr;
+}
+
+void OutputChannel::writeFrame(const nlohmann::json& message) {
+    // 헤더 자리를 비워두고 페이로드를 이어 붙인 뒤 길이를 채운다
+    frame_.assign(kHeaderSize, 0);
+    if (format_ == IpcFormat::MsgPack) {
+        nlohmann::json::to_msgpack(message, frame_);
+    } else {
+        nlohmann::json::to_cbor(message, frame_);
+    }
+    
+    auto length = static_cast<uint32_t>(frame_.size() - kHeaderSize);
+    frame_[0] = static_cast<uint8_t>(length & 0xff);
+    frame_[1] = static_cast<uint8_t>((length >> 8) & 0xff);
+    frame_[2] = static_cast<uint8_t>((length >> 16) & 0xff);
+    frame_[3] = static_cast<uint8_t>((length >> 24) & 0xff);
+    
+    if (!writeAll(frame_.data(), frame_.size())) {
+        std::cerr << "IPC 프레임 전송 실패 (" << frame_.size() << " bytes)" << std::endl;
+    }
+}
+
+bool OutputChannel::writeAll(const uint8_t* data, size_t size) {
+    // 파이프 버퍼가 충분하면 한 번의 write로 끝나고, 부분 쓰기일 때만 반복
+    while (size > 0) {
+#ifdef _WIN32
+        int written = _write(1, data, static_cast<unsigned int>(size));
+#else
+        ssize_t written = ::write(STDOUT_FILENO, data, size);
+#endif
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+} // namespace ipc
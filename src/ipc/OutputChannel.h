@@ -0,0 +1,62 @@
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "MetricsSerializer.h"
+#include "ShmRing.h"
+
+namespace ipc {
+
+// UI 파이프 출력 형식
+enum class IpcFormat {
+    Jsonl,      // 기본: 한 줄에 JSON 하나
+    MsgPack,    // u32le 길이 접두 프레임 + MessagePack
+    Cbor        // u32le 길이 접두 프레임 + CBOR
+};
+
+// "jsonl" / "msgpack" / "cbor" -> IpcFormat (알 수 없으면 false)
+bool parseIpcFormat(const std::string& name, IpcFormat& format);
+const char* ipcFormatName(IpcFormat format);
+
+// 백엔드 -> UI 메시지 출력 채널
+// 바이너리 모드에서는 프레임 하나를 write 시스템 콜 한 번으로 내보낸다.
+class OutputChannel {
+public:
+    static OutputChannel& getInstance();
+
+    void setFormat(IpcFormat format);
+    IpcFormat getFormat() const { return format_; }
+    bool isBinary() const { return format_ != IpcFormat::Jsonl; }
+
+    // BACKEND_READY 직후 스키마 핸드셰이크 전송
+    void sendHandshake(const nlohmann::json& fields);
+
+    // 메시지 하나 전송 (여러 스레드에서 호출 가능)
+    void send(const nlohmann::json& message);
+
+    // metrics 한 틱 전송 - 공유 메모리 링이 연결되어 있으면 링에만 게시 (stdout은 제어 메시지 전용)
+    void sendMetrics(const core::MetricFrame& frame);
+
+    // 공유 메모리 링 연결 (nullptr이면 해제), 링 수명은 호출자가 관리
+    void attachShm(ShmRing* ring);
+    bool hasShm() const { return shm_ != nullptr; }
+
+private:
+    OutputChannel() = default;
+    OutputChannel(const OutputChannel&) = delete;
+    OutputChannel& operator=(const OutputChannel&) = delete;
+
+    void writeFrame(const nlohmann::json& message);
+    static bool writeAll(const uint8_t* data, size_t size);
+
+    IpcFormat format_{IpcFormat::Jsonl};
+    std::mutex mutex_;
+    std::vector<uint8_t> frame_;   // 재사용 프레임 버퍼 (길이 헤더 + 페이로드)
+    MetricsSerializer serializer_; // JSONL metrics 재사용 버퍼
+    ShmRing* shm_{nullptr};        // 단일 작성자 보장은 mutex_로
+};
+
+} // namespace ipc
@@ -0,0 +1,306 @@
+#include "ShmRing.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace ipc {
+
+namespace {
+constexpr size_t kSeqSize = sizeof(uint64_t);
+constexpr size_t kCacheLine = 64;
+
+static_assert(std::atomic_ref<uint64_t>::is_always_lock_free,
+              "seqlock requires lock-free 64-bit atomics across processes");
+static_assert(sizeof(ShmHeader) <= ShmRing::kHeaderSize, "ShmHeader must fit in the header page");
+
+// 상수 필드(event)는 레코드에 싣지 않는다
+constexpr bool isStored(const FieldSpec& spec) {
+    return spec.kind != FieldSpec::Kind::Constant;
+}
+
+constexpr uint32_t storedBytes(const FieldSpec& spec) {
+    return spec.kind == FieldSpec::Kind::CoreVector ? static_cast<uint32_t>(core::CoreLoad::kMaxCores) : 8;
+}
+
+// core_count는 스키마 밖의 레코드 고정 필드 (seq 바로 뒤)
+constexpr char kCoreCountName[] = "core_count";
+constexpr uint32_t kCoreCountOffset = kSeqSize;
+constexpr uint32_t kFirstFieldOffset = kCoreCountOffset + 8;
+
+constexpr uint32_t countStoredFields() {
+    uint32_t count = 1;  // core_count
+    for (const auto& field : kMetricsSchema) {
+        if (isStored(field)) ++count;
+    }
+    return count;
+}
+
+constexpr uint32_t storedPayloadSize() {
+    uint32_t size = kFirstFieldOffset;
+    for (const auto& field : kMetricsSchema) {
+        if (isStored(field)) size += storedBytes(field);
+    }
+    return size;
+}
+
+constexpr uint32_t kFieldCount = countStoredFields();
+static_assert(kFieldCount <= sizeof(ShmHeader::fields) / sizeof(ShmField), "too many fields for ShmHeader");
+
+// 필드 이름은 NUL 포함 ShmField::name에 잘리지 않고 들어가야 한다 (잘리면 읽는 쪽에서 이름이 겹침)
+constexpr bool namesFitField() {
+    if (sizeof(kCoreCountName) > sizeof(ShmField::name)) return false;
+    for (const auto& field : kMetricsSchema) {
+        if (isStored(field) && field.key.size() >= sizeof(ShmField::name)) return false;
+    }
+    return true;
+}
+static_assert(namesFitField(), "kMetricsSchema key too long for ShmField::name");
+
+// 필드를 스키마 순서대로 배치, 레코드는 캐시 라인 단위로 정렬
+constexpr uint32_t kRecordSize =
+    static_cast<uint32_t>((storedPayloadSize() + kCacheLine - 1) / kCacheLine * kCacheLine);
+
+std::atomic_ref<uint64_t> atomicAt(uint8_t* address) {
+    return std::atomic_ref<uint64_t>(*reinterpret_cast<uint64_t*>(address));
+}
+}
+
+ShmRing::~ShmRing() {
+    close();
+}
+
+bool ShmRing::open(const std::string& path, uint32_t capacity) {
+    close();
+    if (capacity == 0) {
+        return false;
+    }
+
+    size_t size = kHeaderSize + static_cast<size_t>(capacity) * kRecordSize;
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        std::cerr << "공유 메모리 파일 생성 실패: " << path << " (" << GetLastError() << ")" << std::endl;
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE,
+                                        static_cast<DWORD>(static_cast<uint64_t>(size) >> 32),
+                                        static_cast<DWORD>(size & 0xffffffff), nullptr);
+    if (!mapping) {
+        std::cerr << "공유 메모리 매핑 실패: " << path << " (" << GetLastError() << ")" << std::endl;
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (!view) {
+        std::cerr << "공유 메모리 뷰 매핑 실패: " << path << " (" << GetLastError() << ")" << std::endl;
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    file_ = file;
+    mapping_ = mapping;
+#else
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        std::cerr << "공유 메모리 파일 생성 실패: " << path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        std::cerr << "공유 메모리 크기 조정 실패: " << path << ": " << std::strerror(errno) << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    void* view = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (view == MAP_FAILED) {
+        std::cerr << "공유 메모리 매핑 실패: " << path << ": " << std::strerror(errno) << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    fd_ = fd;
+#endif
+
+    path_ = path;
+    base_ = static_cast<uint8_t*>(view);
+    size_ = size;
+    capacity_ = capacity;
+    record_size_ = kRecordSize;
+
+    writeHeader();
+    return true;
+}
+
+void ShmRing::close() {
+    if (!base_) return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(base_);
+    CloseHandle(static_cast<HANDLE>(mapping_));
+    CloseHandle(static_cast<HANDLE>(file_));
+    mapping_ = nullptr;
+    file_ = nullptr;
+#else
+    ::munmap(base_, size_);
+    ::close(fd_);
+    fd_ = -1;
+#endif
+
+    base_ = nullptr;
+    size_ = 0;
+}
+
+void ShmRing::writeHeader() {
+    std::memset(base_, 0, kHeaderSize);
+
+    auto* header = reinterpret_cast<ShmHeader*>(base_);
+    header->version = kShmVersion;
+    header->header_size = static_cast<uint32_t>(kHeaderSize);
+    header->record_size = record_size_;
+    header->capacity = capacity_;
+    header->field_count = kFieldCount;
+#ifdef _WIN32
+    header->writer_pid = static_cast<uint32_t>(GetCurrentProcessId());
+#else
+    header->writer_pid = static_cast<uint32_t>(getpid());
+#endif
+
+    auto setField = [](ShmField& field, std::string_view name, uint32_t offset,
+                       ShmFieldType type, uint32_t count) {
+        std::memcpy(field.name, name.data(), std::min(name.size(), sizeof(field.name) - 1));
+        field.offset = offset;
+        field.type = static_cast<uint32_t>(type);
+        field.count = count;
+    };
+
+    setField(header->fields[0], kCoreCountName, kCoreCountOffset, ShmFieldType::Int64, 1);
+
+    uint32_t offset = kFirstFieldOffset;
+    uint32_t index = 1;
+    for (const auto& spec : kMetricsSchema) {
+        if (!isStored(spec)) continue;
+
+        ShmFieldType type = spec.kind == FieldSpec::Kind::Timestamp ? ShmFieldType::Int64
+                          : spec.kind == FieldSpec::Kind::CoreVector ? ShmFieldType::U8Array
+                          : ShmFieldType::Float64;
+        uint32_t count = spec.kind == FieldSpec::Kind::CoreVector ? storedBytes(spec) : 1;
+        setField(header->fields[index++], spec.key, offset, type, count);
+        offset += storedBytes(spec);
+    }
+
+    // 매직은 마지막에 기록 - 읽는 쪽은 매직으로 헤더 완성 여부를 판단
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(header->magic, kShmMagic, sizeof(kShmMagic));
+}
+
+uint8_t* ShmRing::record(uint64_t index) const {
+    return base_ + kHeaderSize + (index % capacity_) * record_size_;
+}
+
+void ShmRing::publish(const core::MetricFrame& frame) {
+    if (!base_) return;
+
+    auto* header = reinterpret_cast<ShmHeader*>(base_);
+    auto write_index = atomicAt(reinterpret_cast<uint8_t*>(&header->write_index));
+    uint64_t index = write_index.load(std::memory_order_relaxed);
+
+    uint8_t* rec = record(index);
+    auto seq = atomicAt(rec);
+
+    // 쓰는 중 표시 -> 값 기록 -> 완료 표시
+    seq.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    int64_t core_count = std::min<int64_t>(frame.cores.count, core::CoreLoad::kMaxCores);
+    std::memcpy(rec + kCoreCountOffset, &core_count, 8);
+
+    uint8_t* out = rec + kFirstFieldOffset;
+    for (const auto& spec : kMetricsSchema) {
+        switch (spec.kind) {
+            case FieldSpec::Kind::Timestamp:
+                std::memcpy(out, &frame.ts, 8);
+                break;
+            case FieldSpec::Kind::Real:
+                std::memcpy(out, &frame.values[core::metricIndex(spec.metric)], 8);
+                break;
+            case FieldSpec::Kind::CoreVector:
+                // 유효 코어만 복사 - 나머지 바이트는 읽는 쪽이 core_count로 잘라낸다
+                std::memcpy(out, (frame.cores.*spec.cores).data(), static_cast<size_t>(core_count));
+                break;
+            case FieldSpec::Kind::Constant:
+                continue;
+        }
+        out += storedBytes(spec);
+    }
+
+    seq.store(2 * index + 2, std::memory_order_release);
+    write_index.store(index + 1, std::memory_order_release);
+}
+
+bool ShmRing::read(uint64_t index, core::MetricFrame& out) const {
+    if (!base_ || index >= getWriteIndex()) return false;
+
+    uint8_t* rec = record(index);
+    auto seq = atomicAt(rec);
+    uint64_t expected = 2 * index + 2;
+    if (seq.load(std::memory_order_acquire) != expected) {
+        return false;
+    }
+
+    core::MetricFrame copy;
+    int64_t core_count = 0;
+    std::memcpy(&core_count, rec + kCoreCountOffset, 8);
+    core_count = std::clamp<int64_t>(core_count, 0, core::CoreLoad::kMaxCores);
+    copy.cores.count = static_cast<uint16_t>(core_count);
+
+    const uint8_t* in = rec + kFirstFieldOffset;
+    for (const auto& spec : kMetricsSchema) {
+        switch (spec.kind) {
+            case FieldSpec::Kind::Timestamp:
+                std::memcpy(&copy.ts, in, 8);
+                break;
+            case FieldSpec::Kind::Real:
+                std::memcpy(&copy.values[core::metricIndex(spec.metric)], in, 8);
+                break;
+            case FieldSpec::Kind::CoreVector:
+                std::memcpy((copy.cores.*spec.cores).data(), in, static_cast<size_t>(core_count));
+                break;
+            case FieldSpec::Kind::Constant:
+                continue;
+        }
+        in += storedBytes(spec);
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (seq.load(std::memory_order_relaxed) != expected) {
+        return false;
+    }
+
+    out = copy;
+    return true;
+}
+
+uint64_t ShmRing::getWriteIndex() const {
+    if (!base_) return 0;
+    auto* header = reinterpret_cast<ShmHeader*>(base_);
+    return atomicAt(reinterpret_cast<uint8_t*>(&header->write_index)).load(std::memory_order_acquire);
+}
+
+} // namespace ipc
@@ -0,0 +1,95 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "MetricsSerializer.h"
+
+namespace ipc {
+
+// 공유 메모리 메트릭 링 (mmap 파일)
+//
+// 파일 레이아웃 (리틀엔디언):
+//   [ShmHeader, kHeaderSize 바이트][레코드 x capacity]
+// 레코드: [u64 seq][i64 core_count][스키마 필드...] - 필드 오프셋/타입/길이는 헤더에 기록
+//   스칼라 필드는 8바이트, 코어 배열(U8Array)은 CoreLoad::kMaxCores 바이트 중 앞 core_count개가 유효
+//
+// 레코드별 seqlock: 인덱스 i를 쓰는 동안 seq = 2i+1, 완료 후 seq = 2i+2.
+// 읽는 쪽은 값 복사 전후의 seq가 모두 2i+2인지 확인하면 찢어진 레코드와
+// 덮어쓰인 슬롯을 함께 걸러낼 수 있다.
+
+inline constexpr char kShmMagic[8] = {'L', 'O', 'S', 'H', 'M', 'R', 'N', 'G'};
+inline constexpr uint32_t kShmVersion = 3;
+
+enum class ShmFieldType : uint32_t { Float64 = 1, Int64 = 2, U8Array = 3 };
+
+struct ShmField {
+    char name[32];        // NUL 포함 - 공개 스키마 키가 잘리지 않는 길이
+    uint32_t offset;      // 레코드 시작 기준
+    uint32_t type;        // ShmFieldType
+    uint32_t count;       // 원소 수 (스칼라 1)
+};
+
+struct ShmHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;     // 첫 레코드 오프셋
+    uint32_t record_size;
+    uint32_t capacity;        // 레코드 수
+    uint32_t field_count;
+    uint32_t writer_pid;
+    uint64_t write_index;     // 완료된 레코드 수 (다음에 쓸 인덱스), atomic_ref로 접근
+    uint64_t reserved[3];
+    ShmField fields[91];      // 헤더 페이지(4096)에 들어가는 최대 개수
+};
+
+static_assert(sizeof(ShmField) == 44, "ShmField layout is part of the file format");
+static_assert(offsetof(ShmHeader, write_index) == 32, "ShmHeader layout is part of the file format");
+static_assert(offsetof(ShmHeader, fields) == 64, "ShmHeader layout is part of the file format");
+
+// 단일 작성자용 링 - publish()는 한 스레드에서만 호출
+class ShmRing {
+public:
+    static constexpr uint32_t kDefaultCapacity = 1024;
+    static constexpr size_t kHeaderSize = 4096;
+
+    ShmRing() = default;
+    ~ShmRing();
+
+    // 파일 생성/크기 조정 후 매핑, 실패 시 false
+    bool open(const std::string& path, uint32_t capacity = kDefaultCapacity);
+    void close();
+    bool isOpen() const { return base_ != nullptr; }
+
+    // 레코드 하나 게시 (할당/시스템 콜 없음)
+    void publish(const core::MetricFrame& frame);
+
+    // 인덱스 index의 레코드 읽기 - 아직 안 쓰였거나, 덮어쓰였거나, 쓰는 중이면 false
+    bool read(uint64_t index, core::MetricFrame& out) const;
+
+    uint64_t getWriteIndex() const;
+    uint32_t getCapacity() const { return capacity_; }
+    uint32_t getRecordSize() const { return record_size_; }
+    const std::string& getPath() const { return path_; }
+
+private:
+    ShmRing(const ShmRing&) = delete;
+    ShmRing& operator=(const ShmRing&) = delete;
+
+    void writeHeader();
+    uint8_t* record(uint64_t index) const;
+
+    std::string path_;
+    uint8_t* base_{nullptr};
+    size_t size_{0};
+    uint32_t capacity_{0};
+    uint32_t record_size_{0};
+
+#ifdef _WIN32
+    void* file_{nullptr};
+    void* mapping_{nullptr};
+#else
+    int fd_{-1};
+#endif
+};
+
+} // namespace ipc
@@ -6,6 +6,11 @@
 #include <atomic>
 #include <sstream>
 #include <iomanip>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <map>
+#include <filesystem>
 #include <nlohmann/json.hpp>
 #ifdef _WIN32
 #include <windows.h>
@@ -13,13 +18,27 @@
 
 // 핵심 모듈
 #include "core/Config.h"
+#include "core/MetricRegistry.h"
 #include "core/SystemMetrics.h"
+#include "core/Scheduler.h"
+#include "core/Collector.h"
 #include "net/Probe.h"
+#include "ipc/OutputChannel.h"
+#include "ipc/MetricsSerializer.h"
+#include "ipc/ShmRing.h"
+#include "sys/PressureMonitor.h"
+#include "sys/CgroupMonitor.h"
+#include "sys/DiskStats.h"
+#include "sys/InterruptSampler.h"
+#include "sys/ProcessMon.h"
+#include "sys/RecordingStall.h"
 
 using namespace core;
 
 // 전역 변수
 std::atomic<bool> running(true);
+std::atomic<bool> obs_recording(false);  // UI가 "recording on|off" 명령으로 알려준다
+ipc::ShmRing shm_ring;  // --shm 사용 시 metrics 전송 경로
 
 // 시그널 핸들러
 void signalHandler(int signal) {
@@ -33,36 +52,338 @@ void initializeLogger() {
     std::cout << "LiveOps Sentinel 시작" << std::endl;
 }
 
-// 메트릭 수집 및 출력
-void collectAndOutputMetrics() {
+// 소스별 수집 스레드와 집계기
+struct CollectorSet {
+    std::unique_ptr<ProcessMonitor> processes;        // 종료 감시 스레드도 수집 스레드보다 나중에 해제
+    std::unique_ptr<sys::PressureMonitor> pressure;   // 수집 스레드보다 먼저 만들고 나중에 해제
+    std::unique_ptr<sys::CgroupMonitor> cgroup;       // cgroup v2가 아니면 nullptr
+    std::unique_ptr<sys::DiskStatsMonitor> disk;
+    std::unique_ptr<sys::InterruptSampler> interrupts;
+    std::vector<std::unique_ptr<core::Collector>> collectors;
+    core::Aggregator aggregator;
+    std::map<std::string, sys::RecordingStallDetector> recording_stalls;  // 감시 이름별 (process 수집 스레드 전용)
+};
+
+// PSI 자원별 메트릭 슬롯
+struct PressureSlots {
+    sys::PressureResource resource;
+    MetricId some_avg10;
+    MetricId full_avg10;
+    MetricId some_us;
+    MetricId full_us;
+};
+
+constexpr PressureSlots kPressureSlots[] = {
+    {sys::PressureResource::Cpu,    MetricId::PsiCpuSomeAvg10, MetricId::PsiCpuFullAvg10, MetricId::PsiCpuSomeUs, MetricId::PsiCpuFullUs},
+    {sys::PressureResource::Memory, MetricId::PsiMemSomeAvg10, MetricId::PsiMemFullAvg10, MetricId::PsiMemSomeUs, MetricId::PsiMemFullUs},
+    {sys::PressureResource::Io,     MetricId::PsiIoSomeAvg10,  MetricId::PsiIoFullAvg10,  MetricId::PsiIoSomeUs,  MetricId::PsiIoFullUs},
+};
+
+// 설정의 psi.cgroup -> PressureMonitor cgroup 디렉터리
+std::string resolvePressureCgroup() {
+    auto& config = core::Config::getInstance();
+    auto cgroup = config.getPressureCgroup();
+    return cgroup == "auto" ? sys::PressureMonitor::detectCgroupDir(config.getCgroupRoot()) : cgroup;
+}
+
+// 호스트별 RTT/지터/손실 + 최근 60초 분포 - 스냅샷은 호스트 수와 무관한 고정 스키마라 프로브 라운드마다 이벤트로 보낸다
+// (응답하지 않은 호스트의 RTT, 커널 타임스탬프가 없는 호스트의 kernel_rtt_ms는 null, hist는 LatencyHistogram::encode())
+void sendRttHosts(const net::Probe& probe) {
+    nlohmann::json hosts = nlohmann::json::array();
+    auto rtts = probe.getHostRtts();
+    for (size_t i = 0; i < rtts.size(); ++i) {
+        const auto& host = rtts[i];
+        auto histogram = probe.getRttHistogram(i);
+        auto percentiles = histogram.getPercentiles();
+        hosts.push_back({
+            {"host", host.name},
+            {"rtt_ms", host.replied ? nlohmann::json(host.rtt_ms) : nlohmann::json(nullptr)},
+            {"user_rtt_ms", host.replied ? nlohmann::json(host.user_rtt_ms) : nlohmann::json(nullptr)},
+            {"kernel_rtt_ms", host.replied && host.kernel_timestamped ? nlohmann::json(host.kernel_rtt_ms) : nlohmann::json(nullptr)},
+            {"p50", percentiles.p50},
+            {"p90", percentiles.p90},
+            {"p99", percentiles.p99},
+            {"p999", percentiles.p999},
+            {"samples", histogram.getTotalCount()},
+            {"hist", histogram.encode()},
+            {"jitter_ms", host.jitter_ms},
+            {"loss_pct", host.loss.loss_pct},
+            {"max_burst", host.loss.max_burst},
+            {"reordered", host.loss.reordered},
+            {"duplicates", host.loss.duplicates},
+            {"timeouts", host.timeouts}
+        });
+    }
+    auto ts = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    ipc::OutputChannel::getInstance().send({
+        {"event", "rtt_hosts"},
+        {"hosts", std::move(hosts)},
+        {"ts", ts}
+    });
+}
+
+// 감시 프로세스별 사용량 - 프로세스 수가 가변이라 스냅샷 대신 수집 주기마다 이벤트로 보낸다
+// (cpu_pct는 시스템 cpu_pct와 같은 기준이라 나란히 비교할 수 있다)
+void sendProcessStats(const std::vector<ProcUsage>& stats) {
+    nlohmann::json processes = nlohmann::json::array();
+    for (const auto& usage : stats) {
+        // 프레임 드롭 때 인코더/렌더/출력 스레드 중 어디가 바쁜지 (cpu_pct는 한 코어 기준)
+        nlohmann::json top_threads = nlohmann::json::array();
+        for (const auto& thread : usage.top_threads) {
+            top_threads.push_back({{"tid", thread.tid}, {"name", thread.name}, {"cpu_pct", thread.cpu_pct}});
+        }
+        nlohmann::json entry = {
+            {"name", usage.name},
+            {"pid", usage.pid},
+            {"running", usage.running},
+            {"cpu_pct", usage.cpu_pct},
+            {"mem_mb", usage.mem_mb},
+            {"threads", usage.threads},
+            {"top_threads", std::move(top_threads)}
+        };
+        // perf 카운터는 열기에 성공한 프로세스만 (권한 부족이면 키 자체가 없다)
+        if (usage.perf_active) {
+            entry["context_switches_per_sec"] = usage.context_switches_per_sec;
+            entry["cpu_migrations_per_sec"] = usage.cpu_migrations_per_sec;
+            entry["page_faults_per_sec"] = usage.page_faults_per_sec;
+            entry["task_clock_cores"] = usage.task_clock_cores;
+        }
+        // /proc/<pid>/io를 읽은 프로세스만 (다른 사용자 프로세스면 키 자체가 없다)
+        if (usage.io_active) {
+            entry["read_bytes_per_sec"] = usage.read_bytes_per_sec;
+            entry["write_bytes_per_sec"] = usage.write_bytes_per_sec;
+            entry["read_syscalls_per_sec"] = usage.read_syscalls_per_sec;
+            entry["write_syscalls_per_sec"] = usage.write_syscalls_per_sec;
+            entry["cancelled_write_bytes"] = usage.cancelled_write_bytes;
+        }
+        processes.push_back(std::move(entry));
+    }
+    auto ts = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    ipc::OutputChannel::getInstance().send({
+        {"event", "process_stats"},
+        {"processes", std::move(processes)},
+        {"ts", ts}
+    });
+}
+
+// 녹화 중인데 저장 장치 쓰기가 멈춘 감시 프로세스 - 정체가 임계 시간을 넘긴 순간 한 번만 보낸다
+void checkRecordingStalls(CollectorSet& set, const std::vector<ProcUsage>& stats) {
+    auto now = sys::RecordingStallDetector::Clock::now();
+    bool recording = obs_recording.load();
+    for (const auto& usage : stats) {
+        auto it = set.recording_stalls.find(usage.name);
+        if (it == set.recording_stalls.end()) continue;
+        auto& detector = it->second;
+        bool stalled = detector.update(recording && usage.running, usage.io_active,
+                                       usage.write_bytes_per_sec, now);
+        if (!stalled) continue;
+        auto ts = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        ipc::OutputChannel::getInstance().send({
+            {"event", "recording_stall"},
+            {"name", usage.name},
+            {"pid", usage.pid},
+            {"stall_s", std::chrono::duration<double>(detector.stalledFor(now)).count()},
+            {"write_bytes_per_sec", usage.write_bytes_per_sec},
+            {"ts", ts}
+        });
+    }
+}
+
+// 소스별 수집 스레드 시작 (각 소스는 자체 스레드/주기로 샘플링, 자기 슬롯만 기록)
+void startCollectors(CollectorSet& set, std::chrono::steady_clock::time_point origin) {
+    auto& config = core::Config::getInstance();
     auto& system_metrics = core::SystemMetrics::getInstance();
     auto& network_probe = net::Probe::getInstance();
     
-    // 시스템 메트릭 수집
-    auto sys_metrics = system_metrics.getMetrics();
+    auto add = [&](const std::string& name, core::MetricSource source, core::Collector::SampleFn fn) {
+        auto period = std::chrono::milliseconds(config.getSourceIntervalMs(name));
+        set.collectors.push_back(std::make_unique<core::Collector>(name, period, std::move(fn), origin));
+        set.aggregator.addSource(*set.collectors.back(), core::sourceMask(source));
+    };
+    
+    add("system", core::MetricSource::System, [&](core::SourceSample& sample) {
+        auto cpu = system_metrics.getCpuBreakdown();
+        sample.metrics[MetricId::CpuPct] = cpu.total_pct;
+        sample.metrics[MetricId::CpuUserPct] = cpu.user_pct;
+        sample.metrics[MetricId::CpuSystemPct] = cpu.system_pct;
+        sample.metrics[MetricId::CpuIowaitPct] = cpu.iowait_pct;
+        sample.metrics[MetricId::CpuStealPct] = cpu.steal_pct;
+        sample.metrics[MetricId::MemoryPct] = system_metrics.getMemoryUsage();
+        sample.metrics[MetricId::MemMb] = system_metrics.getMemoryMB();
+        sample.metrics[MetricId::GpuPct] = system_metrics.getGpuUsage();
+        system_metrics.getCoreLoad(sample.metrics.cores);
+    });
+    
+    // 녹화 쓰기 경로 포화 감시 - 지정 장치가 없으면 가장 바쁜 장치를 보고
+    set.disk = std::make_unique<sys::DiskStatsMonitor>();
+    add("disk", core::MetricSource::Disk, [&set, &system_metrics, device = config.getDiskDevice()](core::SourceSample& sample) {
+        sample.metrics[MetricId::DiskPct] = system_metrics.getDiskUsage();
+        set.disk->sample();
+        if (const auto* disk = set.disk->busiest(device)) {
+            sample.metrics[MetricId::DiskReadMbps] = disk->usage.read_mbps;
+            sample.metrics[MetricId::DiskWriteMbps] = disk->usage.write_mbps;
+            sample.metrics[MetricId::DiskIops] = disk->usage.read_iops + disk->usage.write_iops;
+            sample.metrics[MetricId::DiskQueueDepth] = disk->usage.queue_depth;
+            sample.metrics[MetricId::DiskAwaitMs] = disk->usage.await_ms;
+            sample.metrics[MetricId::DiskUtilPct] = disk->usage.util_pct;
+        }
+    });
+    
+    // NIC softirq 폭주 감시 - 코어별 NET_RX 비중을 스냅샷에 실어 RTT 급등과 비교할 수 있게 한다
+    set.interrupts = std::make_unique<sys::InterruptSampler>();
+    add("irq", core::MetricSource::Interrupt, [&set](core::SourceSample& sample) {
+        auto& sampler = *set.interrupts;
+        if (!sampler.sample()) return;
+        const auto& rates = sampler.getRates();
+        sample.metrics[MetricId::CtxtPerSec] = rates.ctxt_per_s;
+        sample.metrics[MetricId::IntrPerSec] = rates.intr_per_s;
+        sample.metrics[MetricId::SoftirqPerSec] = rates.softirq_per_s;
+        sample.metrics[MetricId::SoftirqNetRxPerSec] = rates.net_rx_per_s;
+        sample.metrics[MetricId::SoftirqNetRxMaxPerSec] = rates.net_rx_max_core_per_s;
+        sample.metrics[MetricId::SoftirqNetRxMaxCore] = static_cast<double>(rates.net_rx_max_core);
+        
+        const auto& cores = sampler.getCores();
+        size_t count = std::min(cores.size(), core::CoreLoad::kMaxCores);
+        core::CoreLoad::quantize(cores.net_rx_share_pct.data(), sample.metrics.cores.net_rx.data(), count);
+    });
     
-    // 네트워크 메트릭 수집
-    auto net_metrics = network_probe.getMetrics();
+    network_probe.setInterface(config.getNetInterface());
+    // 응답 대기 시간(간격의 3/4)이 실제 수집 주기를 따르도록
+    network_probe.setProbeInterval(std::chrono::milliseconds(config.getSourceIntervalMs("network")));
+    add("network", core::MetricSource::Network, [&](core::SourceSample& sample) {
+        network_probe.collect(sample.metrics);
+        sendRttHosts(network_probe);
+    });
+    
+    set.pressure = std::make_unique<sys::PressureMonitor>("/proc/pressure", resolvePressureCgroup());
+    add("pressure", core::MetricSource::Pressure, [&set](core::SourceSample& sample) {
+        auto& monitor = *set.pressure;
+        monitor.sample();
+        for (const auto& slots : kPressureSlots) {
+            const auto& usage = monitor.get(slots.resource);
+            sample.metrics[slots.some_avg10] = usage.some_avg10;
+            sample.metrics[slots.full_avg10] = usage.full_avg10;
+            sample.metrics[slots.some_us] = static_cast<double>(usage.some_stall_us);
+            sample.metrics[slots.full_us] = static_cast<double>(usage.full_stall_us);
+        }
+    });
+    
+    // 감시 프로세스(OBS) PID 추적 - 프로세스별 값은 process_stats 이벤트로 보내고 채우는 슬롯은 없다.
+    // 주기적 stat 확인으로 종료/재시작을 잡아 다시 붙는다 (pidfd 종료 감시도 여기서 붙인 PID를 기다린다).
+    // 집계기는 링만 비운다.
+    set.processes = std::make_unique<ProcessMonitor>();
+    set.processes->setThreadTopN(static_cast<size_t>(std::max(0, config.getThreadTopN())));
+    set.processes->setPerfCounters(config.getPerfCounters());
+    for (const auto& name : config.getProcessNames()) {
+        set.processes->addProcess(name);
+        set.recording_stalls[name].setThreshold(std::chrono::milliseconds(config.getRecordingStallMs()));
+    }
+    set.collectors.push_back(std::make_unique<core::Collector>(
+        "process", std::chrono::milliseconds(config.getSourceIntervalMs("process")),
+        [&set](core::SourceSample&) {
+            auto stats = set.processes->getProcessStats();
+            sendProcessStats(stats);
+            checkRecordingStalls(set, stats);
+        }, origin));
+    set.aggregator.addSource(*set.collectors.back(), 0);
+    
+    // 컨테이너 한도 대비 사용률 - 자기 cgroup을 찾지 못하면 소스 자체를 등록하지 않는다
+    set.cgroup = sys::CgroupMonitor::forSelf(config.getCgroupRoot());
+    if (set.cgroup) {
+        add("cgroup", core::MetricSource::Cgroup, [&set](core::SourceSample& sample) {
+            constexpr double kMiB = 1024.0 * 1024.0;
+            set.cgroup->sample();
+            const auto& usage = set.cgroup->getUsage();
+            sample.metrics[MetricId::CgroupCpuPct] = usage.cpu_pct;
+            sample.metrics[MetricId::CgroupThrottledPct] = usage.throttled_pct;
+            sample.metrics[MetricId::CgroupMemMb] = static_cast<double>(usage.mem_working_set) / kMiB;
+            sample.metrics[MetricId::CgroupMemPct] = usage.mem_pct;
+            sample.metrics[MetricId::CgroupIoReadMbps] = usage.io_read_bps / kMiB;
+            sample.metrics[MetricId::CgroupIoWriteMbps] = usage.io_write_bps / kMiB;
+            sample.metrics[MetricId::CgroupIoIops] = usage.io_read_iops + usage.io_write_iops;
+        });
+    }
+    
+    for (auto& collector : set.collectors) {
+        collector->start();
+    }
+}
+
+// 메트릭 출력 (틱 마감 시점까지 게시된 소스별 최신 샘플 사용)
+void outputMetrics(CollectorSet& set, const core::TickInfo& tick) {
+    set.aggregator.join(tick.deadline);
+    
+    core::MetricFrame frame;
+    set.aggregator.merge(frame);
     
     // 타임스탬프 생성
     auto now = std::chrono::system_clock::now();
-    auto ts = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
-    
-    // JSONL 형식으로 출력 (GUI 호환) - 줄단위로 보장
-    nlohmann::json snapshot = {
-        {"event", "metrics"},
-        {"ts", ts},
-        {"cpu_pct", sys_metrics["cpu_pct"]},
-        {"memory_pct", sys_metrics["memory_pct"]},
-        {"mem_mb", sys_metrics["memory_mb"]},
-        {"gpu_pct", sys_metrics["gpu_pct"]},  // GPU 메트릭 추가
-        {"rtt_ms", net_metrics["rtt_ms"]},
-        {"loss_pct", net_metrics["loss_pct"]},
-        {"uplink_kbps", net_metrics["uplink_kbps"]}
-    };
+    frame.ts = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
+    frame[MetricId::TickLateMs] = tick.lateness.count() / 1000.0;  // 출력 틱 지연
+    
+    ipc::OutputChannel::getInstance().sendMetrics(frame);
+}
+
+// PSI 트리거 감시 - 정체가 임계치를 넘으면 다음 출력 틱을 기다리지 않고 즉시 알림 + 출력
+std::thread startPressureWatch(const sys::PressureMonitor& monitor, core::Scheduler& scheduler, int emit_task) {
+    auto& config = core::Config::getInstance();
+    auto stall = std::chrono::microseconds(std::chrono::milliseconds(config.getPressureTriggerStallMs()));
+    auto window = std::chrono::microseconds(std::chrono::milliseconds(config.getPressureTriggerWindowMs()));
     
-    std::string line = snapshot.dump();
-    std::cout << line << "\n";  // 개행으로 라인 경계 보장
+    auto triggers = std::make_shared<sys::PressureTriggers>();
+    if (stall.count() > 0) {
+        for (const auto& slots : kPressureSlots) {
+            std::error_code ec;
+            if (std::filesystem::exists(monitor.getPath(slots.resource), ec)) {
+                triggers->add(monitor.getPath(slots.resource), slots.resource, sys::PressureKind::Some, stall, window);
+            }
+        }
+    }
+    if (triggers->size() == 0) {
+        return {};
+    }
+    
+    return std::thread([triggers, &scheduler, emit_task]() {
+        // 감시하던 cgroup이 사라져 트리거가 모두 해제되면 스레드를 끝낸다
+        while (running && triggers->size() > 0) {
+            // 종료 확인을 위해 짧게 끊어서 대기
+            auto events = triggers->wait(std::chrono::milliseconds(500));
+            if (events.empty()) continue;
+            
+            auto ts = std::chrono::duration_cast<std::chrono::seconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+            for (const auto& event : events) {
+                ipc::OutputChannel::getInstance().send({
+                    {"event", "pressure_stall"},
+                    {"resource", sys::pressureResourceName(event.resource)},
+                    {"kind", event.kind == sys::PressureKind::Full ? "full" : "some"},
+                    {"stall_us", event.stall.count()},
+                    {"window_us", event.window.count()},
+                    {"ts", ts}
+                });
+            }
+            scheduler.wake(emit_task);
+        }
+    });
+}
+
+// 감시 프로세스 종료(크래시) 알림 - 다음 출력 틱을 기다리지 않고 바로 보낸다
+void startExitWatch(ProcessMonitor& monitor) {
+    monitor.startExitWatch([](const ProcExit& exit) {
+        auto ts = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        ipc::OutputChannel::getInstance().send({
+            {"event", "process_exit"},
+            {"name", exit.name},
+            {"pid", exit.pid},
+            {"restarted_pid", exit.restarted_pid},
+            {"via_pidfd", exit.via_pidfd},
+            {"ts", ts}
+        });
+    });
 }
 
 // 메인 루프
@@ -72,20 +393,40 @@ void runMonitoringLoop() {
     int interval_ms = config.getProbeIntervalMs();
     std::cout << "모니터링 루프 시작 (간격: " << interval_ms << "ms)" << std::endl;
     
-    while (running) {
-        try {
-            collectAndOutputMetrics();
-        } catch (const std::exception& e) {
-            std::cerr << "메트릭 수집 중 오류: " << e.what() << std::endl;
-        }
-        
-        // 지정된 간격만큼 대기
-        std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+    // 절대 마감 기반 스케줄링 - 느린 소스가 다른 소스나 출력 틱을 밀어내지 않는다
+    auto origin = std::chrono::steady_clock::now();
+    CollectorSet set;
+    startCollectors(set, origin);
+    
+    core::Scheduler scheduler(origin);
+    int emit_task = scheduler.addTask("emit", std::chrono::milliseconds(interval_ms),
+        [&](const core::TickInfo& tick) {
+            outputMetrics(set, tick);
+        });
+    
+    std::thread pressure_watch = startPressureWatch(*set.pressure, scheduler, emit_task);
+    startExitWatch(*set.processes);
+    
+    scheduler.run(running);
+    
+    if (pressure_watch.joinable()) {
+        pressure_watch.join();
     }
 }
 
+// 진단 시작/완료 이벤트 출력
+void printDiagnoseEvent(const char* event, const std::string& platform, int duration_seconds) {
+    auto ts = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+    std::cout << "EVENT:" << event << " PLATFORM:" << platform 
+              << " DURATION:" << duration_seconds << " TS:" << ts << std::endl;
+}
+
 // 진단 모드 실행
-void runDiagnosticMode(int duration_seconds, const std::string& platform) {
+// reuse_running: 모니터링 루프가 이미 돌고 있으면(stdin 명령) 두 번째 수집기 세트를 띄우지 않고
+// 실행 중인 출력 스트림에 진단 구간만 표시한다 (감시 프로세스/프로브 싱글턴을 두 루프가 나눠 쓰지 않게)
+void runDiagnosticMode(int duration_seconds, const std::string& platform, bool reuse_running = false) {
     auto& config = core::Config::getInstance();
     
     std::cout << "진단 모드 시작 - 플랫폼: " << platform << ", 지속시간: " << duration_seconds << "초" << std::endl;
@@ -94,32 +435,34 @@ void runDiagnosticMode(int duration_seconds, const std::string& platform) {
     config.setPlatform(platform);
     
     // 진단 시작 이벤트 출력
-    auto start_ts = std::chrono::duration_cast<std::chrono::seconds>(
-        std::chrono::system_clock::now().time_since_epoch()
-    ).count();
-    std::cout << "EVENT:diagnose_start PLATFORM:" << platform 
-              << " DURATION:" << duration_seconds << " TS:" << start_ts << std::endl;
+    printDiagnoseEvent("diagnose_start", platform, duration_seconds);
     
-    // 진단 기간 동안 메트릭 수집
+    // 진단 기간 동안 메트릭 수집 (1초 간격)
     auto start_time = std::chrono::steady_clock::now();
     auto end_time = start_time + std::chrono::seconds(duration_seconds);
     
-    while (running && std::chrono::steady_clock::now() < end_time) {
-        try {
-            collectAndOutputMetrics();
-        } catch (const std::exception& e) {
-            std::cerr << "진단 중 메트릭 수집 오류: " << e.what() << std::endl;
+    if (reuse_running) {
+        while (running && std::chrono::steady_clock::now() < end_time) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
         }
+    } else {
+        CollectorSet set;
+        startCollectors(set, start_time);
         
-        std::this_thread::sleep_for(std::chrono::milliseconds(1000)); // 1초 간격
+        core::Scheduler scheduler(start_time);
+        scheduler.addTask("emit", std::chrono::milliseconds(1000),
+            [&](const core::TickInfo& tick) {
+                outputMetrics(set, tick);
+                if (tick.fired_at >= end_time) {
+                    scheduler.stop();
+                }
+            });
+        
+        scheduler.run(running);
     }
     
     // 진단 완료 이벤트 출력
-    auto end_ts = std::chrono::duration_cast<std::chrono::seconds>(
-        std::chrono::system_clock::now().time_since_epoch()
-    ).count();
-    std::cout << "EVENT:diagnose_done PLATFORM:" << platform 
-              << " DURATION:" << duration_seconds << " TS:" << end_ts << std::endl;
+    printDiagnoseEvent("diagnose_done", platform, duration_seconds);
     
     std::cout << "진단 모드 완료" << std::endl;
 }
@@ -140,7 +483,13 @@ void processCommand(const std::string& command_line) {
                 iss >> platform;
             }
             
-            runDiagnosticMode(duration_sec, platform);
+            // stdin 명령은 모니터링 루프와 함께 돌므로 실행 중인 수집기 세트를 그대로 쓴다
+            runDiagnosticMode(duration_sec, platform, true);
+        } else if (cmd == "recording") {
+            // UI가 OBS 녹화 상태를 알려준다 (예: "recording on")
+            std::string state;
+            iss >> state;
+            obs_recording = (state == "on");
         } else {
             std::cerr << "알 수 없는 명령: " << cmd << std::endl;
         }
@@ -155,14 +504,53 @@ int main(int argc, char* argv[]) {
     std::cout.setf(std::ios::unitbuf);            // << 할 때마다 자동 flush
     setvbuf(stdout, nullptr, _IONBF, 0);          // C stdout도 무버퍼(Windows에서도 OK)
     
+    // IPC 출력 형식 (--ipc=jsonl|msgpack|cbor, --shm=<path>), 나머지 인수는 위치 인수로 처리
+    auto& channel = ipc::OutputChannel::getInstance();
+    std::string shm_path;
+    std::vector<std::string> args;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.rfind("--ipc=", 0) == 0) {
+            ipc::IpcFormat format;
+            if (ipc::parseIpcFormat(arg.substr(6), format)) {
+                channel.setFormat(format);
+            } else {
+                std::cerr << "알 수 없는 IPC 형식: " << arg.substr(6) << std::endl;
+            }
+        } else if (arg.rfind("--shm=", 0) == 0) {
+            shm_path = arg.substr(6);
+        } else {
+            args.push_back(arg);
+        }
+    }
+    
+    // 공유 메모리 링 - 실패하면 기존 파이프 출력으로 계속
+    if (!shm_path.empty()) {
+        if (shm_ring.open(shm_path)) {
+            channel.attachShm(&shm_ring);
+        } else {
+            std::cerr << "공유 메모리 링을 열 수 없어 stdout으로 출력합니다: " << shm_path << std::endl;
+        }
+    }
+    
     // 레디 배너 출력
 #ifdef _WIN32
     SetConsoleOutputCP(CP_UTF8);
-    std::cout << "BACKEND_READY pid=" << GetCurrentProcessId() << "\n";
+    std::cout << "BACKEND_READY pid=" << GetCurrentProcessId()
+              << " ipc=" << ipc::ipcFormatName(channel.getFormat()) << "\n";
 #else
-    std::cout << "BACKEND_READY pid=" << getpid() << "\n";
+    std::cout << "BACKEND_READY pid=" << getpid()
+              << " ipc=" << ipc::ipcFormatName(channel.getFormat()) << "\n";
 #endif
     
+    // 스키마 핸드셰이크 - 바이너리 모드에서는 이후 stdout은 프레임 전용
+    if (channel.isBinary() || channel.hasShm()) {
+        channel.sendHandshake(ipc::schemaFields());
+    }
+    if (channel.isBinary()) {
+        std::cout.rdbuf(std::cerr.rdbuf());
+    }
+    
     // 시그널 핸들러 설정
     signal(SIGINT, signalHandler);
     signal(SIGTERM, signalHandler);
@@ -178,18 +566,20 @@ int main(int argc, char* argv[]) {
         std::cout << "설정 파일: " << config.getConfigPath() << std::endl;
         
         // 명령행 인수 처리
-        if (argc > 1) {
-            std::string arg = argv[1];
+        if (!args.empty()) {
+            const std::string& arg = args[0];
             if (arg == "--help" || arg == "-h") {
                 std::cout << "LiveOps Sentinel - 기본 모니터링 시스템\n";
                 std::cout << "사용법:\n";
                 std::cout << "  " << argv[0] << "                    # 실시간 모니터링\n";
                 std::cout << "  " << argv[0] << " --diagnose <sec>   # 진단 모드\n";
+                std::cout << "  " << argv[0] << " --ipc=<format>     # 출력 형식 (jsonl, msgpack, cbor)\n";
+                std::cout << "  " << argv[0] << " --shm=<path>       # 메트릭을 공유 메모리 링으로 출력\n";
                 std::cout << "  " << argv[0] << " --help             # 도움말\n";
                 return 0;
-            } else if (arg == "--diagnose" && argc > 2) {
-                int duration = std::stoi(argv[2]);
-                std::string platform = (argc > 3) ? argv[3] : "soop";
+            } else if (arg == "--diagnose" && args.size() > 1) {
+                int duration = std::stoi(args[1]);
+                std::string platform = (args.size() > 2) ? args[2] : "soop";
                 runDiagnosticMode(duration, platform);
                 return 0;
             }
@@ -0,0 +1,31 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+
+namespace net {
+
+// RFC 3550 (6.4.1) 도착 간격 지터 - 샘플마다 O(1), 이력 없이 J += (|D| - J) / 16
+// D는 연속한 두 패킷의 전송 시간 차이. 왕복 프로브에서는 RTT 차이가 곧 D다
+// ((R_i - R_j) - (S_i - S_j) = RTT_i - RTT_j). 도착 순서대로 넣는다.
+class JitterEstimator {
+public:
+    void add(double transit_ms) {
+        if (count_ > 0) {
+            double d = std::fabs(transit_ms - last_ms_);
+            jitter_ms_ += (d - jitter_ms_) / 16.0;
+        }
+        last_ms_ = transit_ms;
+        ++count_;
+    }
+
+    double get() const { return jitter_ms_; }
+    uint64_t getCount() const { return count_; }
+    void reset() { *this = JitterEstimator{}; }
+
+private:
+    double jitter_ms_{0};
+    double last_ms_{0};
+    uint64_t count_{0};
+};
+
+} // namespace net
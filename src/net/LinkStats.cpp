@@ -0,0 +1,295 @@
+#include "LinkStats.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+#ifndef _WIN32
+#include <linux/if_link.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+namespace net {
+
+namespace {
+// 덤프 응답 수신 버퍼 (커널 권장 크기 - 링크 하나가 1~2KB)
+constexpr size_t kReceiveBufferSize = 32768;
+// 기본 경로 재확인 주기 (VPN 연결/유무선 전환 등)
+constexpr auto kRouteRefresh = std::chrono::seconds(10);
+}
+
+LinkMonitor::LinkMonitor(std::string interface)
+    : interface_(std::move(interface))
+    , buffer_(kReceiveBufferSize) {
+#ifndef _WIN32
+    fd_ = ::socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (fd_ < 0) {
+        std::cerr << "RTNETLINK 소켓 생성 실패: " << std::strerror(errno) << std::endl;
+        return;
+    }
+    // 응답이 오지 않아도 수집 스레드가 멈추지 않게
+    timeval timeout{1, 0};
+    ::setsockopt(fd_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+#endif
+}
+
+LinkMonitor::~LinkMonitor() {
+#ifndef _WIN32
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+#endif
+}
+
+void LinkMonitor::setInterface(const std::string& interface) {
+    interface_ = interface;
+    active_ifindex_ = 0;
+    route_valid_ = false;
+    primed_ = false;
+    rates_ = LinkRates{};
+}
+
+const LinkInfo* LinkMonitor::getActive() const {
+    for (const auto& link : links_) {
+        if (link.ifindex == active_ifindex_) return &link;
+    }
+    return nullptr;
+}
+
+bool LinkMonitor::sample(Clock::time_point now) {
+#ifdef _WIN32
+    (void)now;
+    return false;
+#else
+    links_.clear();   // 용량은 유지
+    bool ok = dump(RTM_GETLINK, AF_UNSPEC, [this](const nlmsghdr* message) {
+        LinkInfo link;
+        if (parseLink(message, link)) {
+            links_.push_back(link);
+        }
+    });
+    if (!ok) {
+        return false;
+    }
+
+    selectActive(now);
+    const LinkInfo* active = getActive();
+    if (!active) {
+        rates_ = LinkRates{};
+        primed_ = false;
+        return false;
+    }
+
+    const auto& current = active->counters;
+    double seconds = std::chrono::duration<double>(now - last_time_).count();
+    if (primed_ && seconds > 0) {
+        // 링크 재설정으로 카운터가 줄면 0으로 본다
+        auto rate = [seconds](uint64_t value, uint64_t previous) {
+            return value >= previous ? static_cast<double>(value - previous) / seconds : 0.0;
+        };
+        rates_.tx_kbps = rate(current.tx_bytes, last_.tx_bytes) * 8.0 / 1000.0;
+        rates_.rx_kbps = rate(current.rx_bytes, last_.rx_bytes) * 8.0 / 1000.0;
+        rates_.tx_pps = rate(current.tx_packets, last_.tx_packets);
+        rates_.rx_pps = rate(current.rx_packets, last_.rx_packets);
+        rates_.errors_per_s = rate(current.rx_errors, last_.rx_errors) + rate(current.tx_errors, last_.tx_errors);
+        rates_.drops_per_s = rate(current.rx_dropped, last_.rx_dropped) + rate(current.tx_dropped, last_.tx_dropped);
+    }
+    last_ = current;
+    last_time_ = now;
+    primed_ = true;
+    return true;
+#endif
+}
+
+void LinkMonitor::selectActive(Clock::time_point now) {
+    int selected = active_ifindex_;
+    if (!interface_.empty()) {
+        selected = 0;
+        for (const auto& link : links_) {
+            if (link.getName() == interface_) selected = link.ifindex;
+        }
+    } else if (!route_valid_ || now - route_checked_ >= kRouteRefresh || !getActive()) {
+        selected = findDefaultRoute();
+        route_checked_ = now;
+        route_valid_ = true;
+    }
+
+    if (selected != active_ifindex_) {
+        // 다른 NIC로 바뀌면 이전 카운터와 비교하지 않는다
+        active_ifindex_ = selected;
+        primed_ = false;
+        rates_ = LinkRates{};
+    }
+}
+
+int LinkMonitor::findDefaultRoute() {
+#ifdef _WIN32
+    return 0;
+#else
+    for (unsigned char family : {static_cast<unsigned char>(AF_INET), static_cast<unsigned char>(AF_INET6)}) {
+        int best = 0;
+        uint32_t best_metric = 0;
+        dump(RTM_GETROUTE, family, [&](const nlmsghdr* message) {
+            int ifindex = 0;
+            uint32_t metric = 0;
+            if (parseRoute(message, ifindex, metric) && (best == 0 || metric < best_metric)) {
+                best = ifindex;
+                best_metric = metric;
+            }
+        });
+        if (best > 0) {
+            return best;
+        }
+    }
+    return 0;
+#endif
+}
+
+template <typename Fn>
+bool LinkMonitor::dump(uint16_t type, unsigned char family, Fn&& fn) {
+#ifdef _WIN32
+    (void)type;
+    (void)family;
+    (void)fn;
+    return false;
+#else
+    if (fd_ < 0) {
+        return false;
+    }
+
+    struct {
+        nlmsghdr header;
+        union {
+            ifinfomsg link;
+            rtmsg route;
+        } body;
+    } request{};
+    request.header.nlmsg_len = NLMSG_LENGTH(type == RTM_GETLINK ? sizeof(ifinfomsg) : sizeof(rtmsg));
+    request.header.nlmsg_type = type;
+    request.header.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    request.header.nlmsg_seq = ++seq_;
+    if (type == RTM_GETLINK) {
+        request.body.link.ifi_family = family;
+    } else {
+        request.body.route.rtm_family = family;
+    }
+
+    sockaddr_nl kernel{};
+    kernel.nl_family = AF_NETLINK;
+    if (::sendto(fd_, &request, request.header.nlmsg_len, 0,
+                 reinterpret_cast<const sockaddr*>(&kernel), sizeof(kernel)) < 0) {
+        return false;
+    }
+
+    while (true) {
+        ssize_t n = ::recv(fd_, buffer_.data(), buffer_.size(), 0);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;   // 타임아웃 포함
+        }
+        if (n == 0) {
+            return false;
+        }
+        int remaining = static_cast<int>(n);
+        for (auto* message = reinterpret_cast<const nlmsghdr*>(buffer_.data()); NLMSG_OK(message, remaining);
+             message = NLMSG_NEXT(message, remaining)) {
+            if (message->nlmsg_seq != seq_) continue;   // 이전 요청(타임아웃)의 늦은 응답
+            if (message->nlmsg_type == NLMSG_DONE) return true;
+            if (message->nlmsg_type == NLMSG_ERROR) return false;
+            fn(message);
+        }
+    }
+#endif
+}
+
+bool LinkMonitor::parseLink(const nlmsghdr* message, LinkInfo& link) {
+#ifdef _WIN32
+    (void)message;
+    (void)link;
+    return false;
+#else
+    if (message->nlmsg_type != RTM_NEWLINK || message->nlmsg_len < NLMSG_LENGTH(sizeof(ifinfomsg))) {
+        return false;
+    }
+    const auto* info = static_cast<const ifinfomsg*>(NLMSG_DATA(message));
+    link = LinkInfo{};
+    link.ifindex = info->ifi_index;
+
+    bool has_stats64 = false;
+    bool has_name = false;
+    int length = static_cast<int>(IFLA_PAYLOAD(message));
+    for (const auto* attr = IFLA_RTA(info); RTA_OK(attr, length); attr = RTA_NEXT(attr, length)) {
+        size_t payload = RTA_PAYLOAD(attr);
+        if (attr->rta_type == IFLA_IFNAME) {
+            size_t copy = std::min(payload, link.name.size() - 1);
+            std::memcpy(link.name.data(), RTA_DATA(attr), copy);
+            link.name[copy] = '\0';
+            has_name = true;
+        } else if (attr->rta_type == IFLA_STATS64) {
+            // 속성 데이터는 4바이트 정렬이라 복사해서 읽는다 (커널 버전에 따라 구조체 길이가 다름)
+            rtnl_link_stats64 stats{};
+            std::memcpy(&stats, RTA_DATA(attr), std::min(payload, sizeof(stats)));
+            link.counters = {stats.rx_bytes, stats.tx_bytes, stats.rx_packets, stats.tx_packets,
+                             stats.rx_errors, stats.tx_errors, stats.rx_dropped, stats.tx_dropped};
+            has_stats64 = true;
+        } else if (attr->rta_type == IFLA_STATS && !has_stats64) {
+            // 32비트 카운터 - IFLA_STATS64가 없는 오래된 커널
+            rtnl_link_stats stats{};
+            std::memcpy(&stats, RTA_DATA(attr), std::min(payload, sizeof(stats)));
+            link.counters = {stats.rx_bytes, stats.tx_bytes, stats.rx_packets, stats.tx_packets,
+                             stats.rx_errors, stats.tx_errors, stats.rx_dropped, stats.tx_dropped};
+        }
+    }
+    return has_name && link.ifindex > 0;
+#endif
+}
+
+bool LinkMonitor::parseRoute(const nlmsghdr* message, int& ifindex, uint32_t& metric) {
+#ifdef _WIN32
+    (void)message;
+    (void)ifindex;
+    (void)metric;
+    return false;
+#else
+    if (message->nlmsg_type != RTM_NEWROUTE || message->nlmsg_len < NLMSG_LENGTH(sizeof(rtmsg))) {
+        return false;
+    }
+    const auto* route = static_cast<const rtmsg*>(NLMSG_DATA(message));
+    if (route->rtm_dst_len != 0 || route->rtm_type != RTN_UNICAST) {
+        return false;
+    }
+
+    uint32_t table = route->rtm_table;
+    ifindex = 0;
+    metric = 0;
+    int length = static_cast<int>(RTM_PAYLOAD(message));
+    for (const auto* attr = RTM_RTA(route); RTA_OK(attr, length); attr = RTA_NEXT(attr, length)) {
+        switch (attr->rta_type) {
+            case RTA_TABLE:
+                std::memcpy(&table, RTA_DATA(attr), sizeof(table));
+                break;
+            case RTA_OIF:
+                std::memcpy(&ifindex, RTA_DATA(attr), sizeof(ifindex));
+                break;
+            case RTA_PRIORITY:
+                std::memcpy(&metric, RTA_DATA(attr), sizeof(metric));
+                break;
+            case RTA_MULTIPATH:
+                // ECMP 기본 경로 - 첫 번째 next hop
+                if (ifindex == 0 && RTA_PAYLOAD(attr) >= sizeof(rtnexthop)) {
+                    ifindex = static_cast<const rtnexthop*>(RTA_DATA(attr))->rtnh_ifindex;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    return table == RT_TABLE_MAIN && ifindex > 0;
+#endif
+}
+
+} // namespace net
@@ -0,0 +1,96 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct nlmsghdr;
+
+namespace net {
+
+// 인터페이스 누적 카운터 (IFLA_STATS64)
+struct LinkCounters {
+    uint64_t rx_bytes{0};
+    uint64_t tx_bytes{0};
+    uint64_t rx_packets{0};
+    uint64_t tx_packets{0};
+    uint64_t rx_errors{0};
+    uint64_t tx_errors{0};
+    uint64_t rx_dropped{0};
+    uint64_t tx_dropped{0};
+};
+
+struct LinkInfo {
+    int ifindex{0};
+    std::array<char, 16> name{};    // IFNAMSIZ
+    LinkCounters counters;
+
+    std::string_view getName() const { return name.data(); }
+};
+
+// 두 샘플 사이 비율
+struct LinkRates {
+    double tx_kbps{0};
+    double rx_kbps{0};
+    double tx_pps{0};
+    double rx_pps{0};
+    double errors_per_s{0};         // rx + tx
+    double drops_per_s{0};          // rx + tx
+};
+
+// RTNETLINK 기반 인터페이스 처리량 모니터
+// 틱마다 RTM_GETLINK 덤프 한 번으로 모든 링크의 64비트 카운터를 읽고(텍스트 파싱 없음),
+// 선택된 인터페이스의 비율을 단조 시계 기준으로 계산한다. 인터페이스를 지정하지 않으면
+// 기본 경로(default route)의 출력 인터페이스 = 방송 송출 NIC를 따라간다.
+class LinkMonitor {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit LinkMonitor(std::string interface = "");
+    ~LinkMonitor();
+
+    // "" = 기본 경로 인터페이스 자동 선택
+    void setInterface(const std::string& interface);
+
+    // 덤프 한 번 + 비율 갱신, 선택된 인터페이스를 찾지 못하면 false
+    bool sample() { return sample(Clock::now()); }
+    bool sample(Clock::time_point now);
+
+    const LinkRates& getRates() const { return rates_; }
+    const LinkInfo* getActive() const;
+    const std::vector<LinkInfo>& getLinks() const { return links_; }
+
+    // 기본 경로 출력 인터페이스 (IPv4 우선, 없으면 IPv6), 없으면 0
+    int findDefaultRoute();
+
+    // 메시지 파싱 (테스트용 공개)
+    static bool parseLink(const nlmsghdr* message, LinkInfo& link);
+    // 메인 테이블의 기본 경로면 true (ifindex/metric 채움)
+    static bool parseRoute(const nlmsghdr* message, int& ifindex, uint32_t& metric);
+
+private:
+    LinkMonitor(const LinkMonitor&) = delete;
+    LinkMonitor& operator=(const LinkMonitor&) = delete;
+
+    template <typename Fn>
+    bool dump(uint16_t type, unsigned char family, Fn&& fn);
+    void selectActive(Clock::time_point now);
+
+    std::string interface_;
+    int fd_{-1};
+    uint32_t seq_{0};
+    std::vector<char> buffer_;
+    std::vector<LinkInfo> links_;
+
+    int active_ifindex_{0};
+    LinkCounters last_;
+    Clock::time_point last_time_{};
+    bool primed_{false};
+    Clock::time_point route_checked_{};
+    bool route_valid_{false};
+    LinkRates rates_;
+};
+
+} // namespace net
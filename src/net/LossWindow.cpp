@@ -0,0 +1,76 @@
+#include "LossWindow.h"
+#include <algorithm>
+
+namespace net {
+
+void LossWindow::sent(uint32_t seq) {
+    if (seq <= head_) {
+        return;
+    }
+    // 창으로 들어오는 시퀀스 비트를 비운다 (건너뛴 번호 포함, 최대 창 크기만큼)
+    uint32_t first = seq - head_ > kSize ? seq - kSize + 1 : head_ + 1;
+    for (uint32_t s = first; s <= seq; ++s) {
+        clear(s);
+    }
+    head_ = seq;
+}
+
+LossWindow::Arrival LossWindow::received(uint32_t seq) {
+    if (seq == 0 || seq > head_) {
+        return Arrival::Unknown;
+    }
+    if (head_ - seq >= kSize) {
+        ++totals_.late;   // 창 밖 - 기록할 곳이 없다
+        return Arrival::Late;
+    }
+    if (test(seq)) {
+        ++totals_.duplicates;
+        return Arrival::Duplicate;
+    }
+    set(seq);
+
+    Arrival arrival = Arrival::Fresh;
+    if (seq <= settled_) {
+        ++totals_.late;
+        arrival = Arrival::Late;
+    } else if (seq < highest_received_) {
+        ++totals_.reordered;
+        arrival = Arrival::Reordered;
+    }
+    highest_received_ = std::max(highest_received_, seq);
+    return arrival;
+}
+
+void LossWindow::settle() {
+    // 새로 확정되는 시퀀스로 연속 손실 갱신
+    uint32_t first = head_ - settled_ > kSize ? head_ - kSize + 1 : settled_ + 1;
+    for (uint32_t s = first; s <= head_; ++s) {
+        run_ = test(s) ? 0 : run_ + 1;
+        totals_.longest_burst = std::max(totals_.longest_burst, run_);
+    }
+    settled_ = head_;
+}
+
+void LossWindow::reset() {
+    *this = LossWindow{};
+}
+
+LossStats LossWindow::getStats() const {
+    LossStats stats = totals_;
+    stats.window = std::min(settled_, kSize);
+    uint32_t run = 0;
+    for (uint32_t s = settled_ - stats.window + 1; s <= settled_ && stats.window > 0; ++s) {
+        if (test(s)) {
+            run = 0;
+        } else {
+            ++stats.lost;
+            stats.max_burst = std::max(stats.max_burst, ++run);
+        }
+    }
+    if (stats.window > 0) {
+        stats.loss_pct = 100.0 * stats.lost / stats.window;
+    }
+    return stats;
+}
+
+} // namespace net
@@ -0,0 +1,51 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+namespace net {
+
+// 손실 창 요약 (확정된 시퀀스 기준)
+struct LossStats {
+    uint32_t window{0};            // 창 안의 확정 시퀀스 수
+    uint32_t lost{0};
+    double loss_pct{0};
+    uint32_t max_burst{0};         // 창 안 최장 연속 손실
+    uint32_t longest_burst{0};     // 시작 이후 최장 연속 손실 (확정 시점 기준)
+    uint64_t reordered{0};         // 더 뒤 시퀀스보다 늦게 도착
+    uint64_t duplicates{0};
+    uint64_t late{0};              // 대기 시간이 끝난 뒤 도착 (확정 때는 손실로 셌던 것)
+};
+
+// 시퀀스 번호 기반 손실 창 - 최근 kSize개 시퀀스의 수신 여부를 비트맵으로 들고 있는다
+// 보낸 순서대로 sent(), 응답마다 received(), 대기 시간이 끝나면 settle()로 확정한다.
+// 손실률/연속 손실은 확정된 시퀀스만 센다 (아직 응답을 기다리는 시퀀스는 제외).
+class LossWindow {
+public:
+    static constexpr uint32_t kSize = 256;
+
+    enum class Arrival : uint8_t { Fresh, Reordered, Duplicate, Late, Unknown };
+
+    // seq는 1부터 단조 증가
+    void sent(uint32_t seq);
+    Arrival received(uint32_t seq);
+    // 지금까지 보낸 시퀀스를 모두 확정
+    void settle();
+    void reset();
+
+    LossStats getStats() const;
+    uint32_t getHead() const { return head_; }
+
+private:
+    bool test(uint32_t seq) const { return (bits_[(seq % kSize) / 64] >> (seq % 64)) & 1; }
+    void set(uint32_t seq) { bits_[(seq % kSize) / 64] |= uint64_t{1} << (seq % 64); }
+    void clear(uint32_t seq) { bits_[(seq % kSize) / 64] &= ~(uint64_t{1} << (seq % 64)); }
+
+    std::array<uint64_t, kSize / 64> bits_{};
+    uint32_t head_{0};             // 마지막으로 보낸 시퀀스
+    uint32_t settled_{0};          // 이 시퀀스까지 확정
+    uint32_t highest_received_{0};
+    uint32_t run_{0};              // 확정 시점의 진행 중인 연속 손실
+    LossStats totals_;             // 누적 카운터 (reordered/duplicates/late/longest_burst)
+};
+
+} // namespace net
@@ -1,4 +1,6 @@
 #include "NetworkDiagnostics.h"
+#include "JitterEstimator.h"
+#include "RttProber.h"
 #include <iostream>
 #include <algorithm>
 #include <numeric>
@@ -120,22 +122,40 @@ BandwidthTest NetworkDiagnostics::bandwidthTest(const std::string& target, int d
 }
 
 double NetworkDiagnostics::measurePacketLoss(const std::string& target, int packet_count) {
+    return measureLoss(target, packet_count).loss_pct;
+}
+
+LossStats NetworkDiagnostics::measureLoss(const std::string& target, int packet_count) {
     if (progress_callback_) {
         progress_callback_(0, "패킷 손실 측정 시작: " + target);
     }
     
-    // 패킷 손실 측정 시뮬레이션
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<> loss_dist(0.0, 5.0);
+    ProbeTarget probe_target;
+    if (!ProbeTarget::parse(target, probe_target)) {
+        std::cerr << "손실 측정 대상 형식 오류: " << target << std::endl;
+        return {};
+    }
     
-    double loss_rate = loss_dist(gen);
+    // UDP 에코 대상은 트레인으로, TCP 대상은 connect 한 번씩 (손실 창은 최근 256발)
+    RttProber prober;
+    prober.setTargets({probe_target});
+    int sent = 0;
+    while (sent < packet_count) {
+        prober.setTrainLength(static_cast<uint32_t>(packet_count - sent));
+        prober.probe(std::chrono::milliseconds(1000));
+        const auto& host = prober.getHosts().front();
+        if (!host.resolved) break;
+        sent = static_cast<int>(host.sent);
+        if (progress_callback_) {
+            progress_callback_(sent * 100 / packet_count, "패킷 손실 측정 중: " + target);
+        }
+    }
     
+    LossStats stats = prober.getHosts().front().loss;
     if (progress_callback_) {
         progress_callback_(100, "패킷 손실 측정 완료: " + target);
     }
-    
-    return loss_rate;
+    return stats;
 }
 
 NetworkQuality NetworkDiagnostics::assessNetworkQuality(const std::string& target) {
@@ -365,13 +385,15 @@ std::vector<NetworkDiagnostics::NetworkIssue> NetworkDiagnostics::diagnoseIssues
         issues.push_back(issue);
     }
     
-    // 패킷 손실 진단
-    double packet_loss = measurePacketLoss(target, 100);
-    if (detectPacketLoss(packet_loss)) {
+    // 패킷 손실 진단 - 연속 손실이 길면 RTMP 세션이 끊기므로 비율이 낮아도 심각으로 본다
+    auto loss = measureLoss(target, 100);
+    double packet_loss = loss.loss_pct;
+    if (detectPacketLoss(packet_loss) || loss.max_burst >= 3) {
         NetworkIssue issue;
         issue.type = "packet_loss";
-        issue.severity = packet_loss > 10.0 ? "critical" : "medium";
-        issue.description = "패킷 손실률이 " + std::to_string(packet_loss) + "%입니다";
+        issue.severity = packet_loss > 10.0 || loss.max_burst >= 5 ? "critical" : "medium";
+        issue.description = "패킷 손실률이 " + std::to_string(packet_loss) + "%입니다 (최장 연속 손실 "
+                          + std::to_string(loss.max_burst) + "개)";
         issue.recommendations = {"네트워크 케이블 확인", "라우터 재시작", "ISP에 문의"};
         issue.confidence = 0.85;
         issues.push_back(issue);
@@ -454,13 +476,12 @@ void NetworkDiagnostics::setProgressCallback(ProgressCallback callback) {
 
 // 내부 헬퍼 함수들
 double NetworkDiagnostics::calculateJitter(const std::vector<double>& latencies) {
-    if (latencies.size() < 2) return 0.0;
-    
-    double jitter = 0.0;
-    for (size_t i = 1; i < latencies.size(); ++i) {
-        jitter += std::abs(latencies[i] - latencies[i-1]);
+    // 실시간 프로브와 같은 RFC 3550 추정기 (측정 순서대로 반영)
+    JitterEstimator jitter;
+    for (double latency : latencies) {
+        jitter.add(latency);
     }
-    return jitter / (latencies.size() - 1);
+    return jitter.get();
 }
 
 double NetworkDiagnostics::calculateStandardDeviation(const std::vector<double>& values) {
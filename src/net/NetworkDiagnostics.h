@@ -5,6 +5,7 @@
 #include <memory>
 #include <functional>
 #include <nlohmann/json.hpp>
+#include "LossWindow.h"
 
 using json = nlohmann::json;
 
@@ -62,6 +63,8 @@ public:
     std::vector<PingResult> pingTest(const std::vector<std::string>& targets, int count = 5);
     BandwidthTest bandwidthTest(const std::string& target, int duration_seconds = 30);
     double measurePacketLoss(const std::string& target, int packet_count = 100);
+    // 시퀀스 번호 프로브 트레인으로 손실/연속 손실/순서 뒤바뀜 측정 (target은 Probe 대상 형식)
+    LossStats measureLoss(const std::string& target, int packet_count = 100);
     
     // 고급 진단 기능
     NetworkQuality assessNetworkQuality(const std::string& target);
@@ -73,7 +76,7 @@ public:
         double min_latency;
         double max_latency;
         double avg_latency;
-        double jitter;         // 지터 (변동성)
+        double jitter;         // RFC 3550 지터 (Probe의 jitter_ms와 같은 추정기)
         double std_deviation;  // 표준편차
         std::vector<double> latency_history;
     };
@@ -1,4 +1,6 @@
 #include "Probe.h"
+#include "LinkStats.h"
+#include "RttProber.h"
 #include <chrono>
 #include <vector>
 #include <random>
@@ -7,6 +9,7 @@
 #include <regex>
 #include <algorithm>
 #include <cmath>
+#include <iostream>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -26,27 +29,51 @@ namespace net {
 class Probe::ProbeImpl {
 public:
     ProbeImpl() : last_check_time_(std::chrono::steady_clock::now()) {
+#ifndef _WIN32
+        prober_.setTrainLength(kProbeTrain);
+#endif
+        setProbeHosts(probe_hosts_);
         initializeNetworkCounters();
     }
     
     ~ProbeImpl() = default;
     
-    std::map<std::string, double> getMetrics() {
+    void collect(core::MetricFrame& frame) {
         auto now = std::chrono::steady_clock::now();
         
         // 네트워크 카운터 업데이트
         updateNetworkCounters();
+        updateHistograms(now);
         
-        std::map<std::string, double> metrics;
-        metrics["rtt_ms"] = getRttMs();
-        metrics["loss_pct"] = getLossPercent();
-        metrics["uplink_kbps"] = getUplinkKbps();
+        frame[core::MetricId::RttMs] = getRttMs();
+        frame[core::MetricId::LossPct] = getLossPercent();
+        frame[core::MetricId::UplinkKbps] = getUplinkKbps();
+#ifndef _WIN32
+        frame[core::MetricId::RttMinMs] = prober_.getRound().min_rtt_ms;
+        // 커널 타임스탬프 RTT와의 차이 = 이 호스트(스케줄링/epoll 복귀)가 더한 지연
+        frame[core::MetricId::RttUserMs] = prober_.getRound().user_rtt_ms;
+        frame[core::MetricId::RttKernelMs] = prober_.getRound().kernel_rtt_ms;
+        frame[core::MetricId::RttHostDelayMs] = prober_.getRound().host_delay_ms;
+        frame[core::MetricId::LossBurst] = prober_.getRound().max_burst;
+        frame[core::MetricId::JitterMs] = prober_.getRound().jitter_ms;
+        auto percentiles = all_hosts_.getPercentiles();
+        frame[core::MetricId::RttP50Ms] = percentiles.p50;
+        frame[core::MetricId::RttP90Ms] = percentiles.p90;
+        frame[core::MetricId::RttP99Ms] = percentiles.p99;
+        frame[core::MetricId::RttP999Ms] = percentiles.p999;
+        const auto& link = link_.getRates();
+        frame[core::MetricId::NetRxKbps] = link.rx_kbps;
+        frame[core::MetricId::NetTxPps] = link.tx_pps;
+        frame[core::MetricId::NetRxPps] = link.rx_pps;
+        frame[core::MetricId::NetErrorsPerSec] = link.errors_per_s;
+        frame[core::MetricId::NetDropsPerSec] = link.drops_per_s;
+#endif
         
         last_check_time_ = now;
-        return metrics;
     }
     
     double getRttMs() {
+#ifdef _WIN32
         // 간단한 RTT 측정 (실제로는 ping 명령어나 TCP connect 사용)
         // 여기서는 시뮬레이션된 값 반환
         static std::random_device rd;
@@ -54,9 +81,14 @@ public:
         static std::normal_distribution<> d(50.0, 10.0); // 평균 50ms, 표준편차 10ms
         
         return std::fmax(1.0, d(gen));
+#else
+        // 이번 라운드 응답 호스트들의 중앙값 (한 곳도 응답하지 않으면 0)
+        return prober_.getRound().median_rtt_ms;
+#endif
     }
     
     double getLossPercent() {
+#ifdef _WIN32
         // 간단한 패킷 손실 측정 (실제로는 ping 통계 사용)
         // 여기서는 시뮬레이션된 값 반환
         static std::random_device rd;
@@ -64,9 +96,14 @@ public:
         static std::exponential_distribution<> d(0.01); // 평균 1% 손실
         
         return std::fmin(100.0, d(gen));
+#else
+        // 호스트별 시퀀스 창(최근 256발)을 합친 손실률
+        return prober_.getRound().loss_pct;
+#endif
     }
     
     double getUplinkKbps() {
+#ifdef _WIN32
         // 업링크 대역폭 측정 (실제로는 speedtest-cli나 네트워크 카운터 사용)
         // 여기서는 시뮬레이션된 값 반환
         static std::random_device rd;
@@ -74,10 +111,53 @@ public:
         static std::normal_distribution<> d(10000.0, 2000.0); // 평균 10Mbps, 표준편차 2Mbps
         
         return std::fmax(100.0, d(gen));
+#else
+        // 송출 NIC의 실제 송신 처리량 (updateNetworkCounters에서 갱신)
+        return link_.getRates().tx_kbps;
+#endif
+    }
+    
+    void setInterface(const std::string& interface) {
+#ifdef _WIN32
+        (void)interface;
+#else
+        link_.setInterface(interface);
+#endif
     }
     
     void setProbeHosts(const std::vector<std::string>& hosts) {
         probe_hosts_ = hosts;
+#ifndef _WIN32
+        std::vector<ProbeTarget> targets;
+        for (const auto& host : hosts) {
+            ProbeTarget target;
+            if (ProbeTarget::parse(host, target)) {
+                targets.push_back(std::move(target));
+            } else {
+                std::cerr << "프로브 대상 형식 오류: " << host << std::endl;
+            }
+        }
+        prober_.setTargets(targets);
+        windows_.assign(prober_.getHosts().size(), core::LatencyWindow{});
+        all_hosts_.reset();
+#endif
+    }
+    
+    const core::LatencyHistogram& getRttHistogram() const {
+        return all_hosts_;
+    }
+    
+    const core::LatencyHistogram& getRttHistogram(size_t host) const {
+        static const core::LatencyHistogram empty;
+        return host < windows_.size() ? windows_[host].get() : empty;
+    }
+    
+    std::vector<HostRtt> getHostRtts() const {
+#ifdef _WIN32
+        return {};
+#else
+        return prober_.getHosts();
+#endif
     }
     
     void setProbeInterval(std::chrono::milliseconds interval) {
@@ -88,6 +168,8 @@ private:
     std::chrono::steady_clock::time_point last_check_time_;
     std::vector<std::string> probe_hosts_{"8.8.8.8", "1.1.1.1", "208.67.222.222"};
     std::chrono::milliseconds probe_interval_{1000};
+    std::vector<core::LatencyWindow> windows_;   // 호스트별 최근 60초 RTT 분포
+    core::LatencyHistogram all_hosts_;           // windows_ 합 (모든 호스트)
     
     // 네트워크 카운터 (Windows)
 #ifdef _WIN32
@@ -100,6 +182,8 @@ private:
         updateNetworkCounters();
     }
     
+    void updateHistograms(std::chrono::steady_clock::time_point) {}
+    
     void updateNetworkCounters() {
         MIB_IFROW ifRow;
         memset(&ifRow, 0, sizeof(ifRow));
@@ -113,12 +197,31 @@ private:
         }
     }
 #else
+    LinkMonitor link_;   // RTNETLINK 링크 카운터 (기본 경로 인터페이스 자동 선택)
+    RttProber prober_;   // 모든 프로브 호스트 동시 RTT 측정
+    static constexpr uint32_t kProbeTrain = 4;   // UDP 에코 대상에 라운드마다 보낼 발 수
+    
     void initializeNetworkCounters() {
-        // Linux에서는 /proc/net/dev 사용
+        link_.sample();   // 첫 샘플은 기준값
     }
     
+    core::LatencyHistogram interval_;   // takeInterval 임시 (고정 크기라 틱마다 재사용)
+    
     void updateNetworkCounters() {
-        // Linux에서는 /proc/net/dev 사용
+        link_.sample();
+        // 다음 수집 주기를 밀어내지 않도록 주기의 3/4까지만 기다린다
+        prober_.probe(probe_interval_ * 3 / 4);
+    }
+    
+    // 이번 틱 구간 분포를 호스트별 이동 창에 합치고, 창들을 다시 합쳐 전체 분포를 만든다
+    void updateHistograms(std::chrono::steady_clock::time_point now) {
+        all_hosts_.reset();
+        for (size_t i = 0; i < windows_.size(); ++i) {
+            if (prober_.takeInterval(i, interval_)) {
+                windows_[i].add(interval_, now);
+            }
+            all_hosts_.add(windows_[i].get());
+        }
     }
 #endif
 };
@@ -133,28 +236,54 @@ Probe::Probe() : impl_(std::make_unique<ProbeImpl>()) {}
 
 Probe::~Probe() = default;
 
-std::map<std::string, double> Probe::getMetrics() {
-    return impl_->getMetrics();
+void Probe::collect(core::MetricFrame& frame) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    impl_->collect(frame);
 }
 
 double Probe::getRttMs() {
+    std::lock_guard<std::mutex> lock(mutex_);
     return impl_->getRttMs();
 }
 
 double Probe::getLossPercent() {
+    std::lock_guard<std::mutex> lock(mutex_);
     return impl_->getLossPercent();
 }
 
 double Probe::getUplinkKbps() {
+    std::lock_guard<std::mutex> lock(mutex_);
     return impl_->getUplinkKbps();
 }
 
 void Probe::setProbeHosts(const std::vector<std::string>& hosts) {
+    std::lock_guard<std::mutex> lock(mutex_);
     impl_->setProbeHosts(hosts);
 }
 
+std::vector<HostRtt> Probe::getHostRtts() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return impl_->getHostRtts();
+}
+
+core::LatencyHistogram Probe::getRttHistogram() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return impl_->getRttHistogram();
+}
+
+core::LatencyHistogram Probe::getRttHistogram(size_t host) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return impl_->getRttHistogram(host);
+}
+
 void Probe::setProbeInterval(std::chrono::milliseconds interval) {
+    std::lock_guard<std::mutex> lock(mutex_);
     impl_->setProbeInterval(interval);
 }
 
+void Probe::setInterface(const std::string& interface) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    impl_->setInterface(interface);
+}
+
 } // namespace net 
\ No newline at end of file
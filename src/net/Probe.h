@@ -2,8 +2,10 @@
 #include <string>
 #include <vector>
 #include <chrono>
-#include <map>
 #include <memory>
+#include <mutex>
+#include "../core/MetricRegistry.h"
+#include "RttProber.h"
 
 namespace net {
 
@@ -14,17 +16,26 @@ public:
     Probe();
     ~Probe();
     
-    // 네트워크 메트릭 수집
-    std::map<std::string, double> getMetrics();
+    // 네트워크 메트릭을 지정 슬롯에 수집
+    void collect(core::MetricFrame& frame);
     
     // 개별 메트릭 조회
     double getRttMs();
     double getLossPercent();
     double getUplinkKbps();
+    // 호스트별 최근 라운드 결과 (Linux)
+    std::vector<HostRtt> getHostRtts() const;
+    // 최근 60초 RTT 분포 - 모든 호스트 합 / 호스트별 (getHostRtts 순서)
+    // 다음 collect()가 덮어쓰므로 복사본을 돌려준다
+    core::LatencyHistogram getRttHistogram() const;
+    core::LatencyHistogram getRttHistogram(size_t host) const;
     
     // 설정
+    // "8.8.8.8" (TCP 53), "host:port" (TCP connect), "udp://host:port" (UDP 에코)
     void setProbeHosts(const std::vector<std::string>& hosts);
     void setProbeInterval(std::chrono::milliseconds interval);
+    // 업링크를 잴 인터페이스 ("" = 기본 경로 인터페이스 자동 선택, Linux)
+    void setInterface(const std::string& interface);
     
 private:
     Probe(const Probe&) = delete;
@@ -32,6 +43,8 @@ private:
     
     class ProbeImpl;
     std::unique_ptr<ProbeImpl> impl_;
+    // 수집 루프와 stdin 진단 모드가 같은 인스턴스를 동시에 쓸 수 있다 (RttProber/LinkMonitor 보호)
+    mutable std::mutex mutex_;
 };
 
 } // namespace net
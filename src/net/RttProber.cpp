@@ -0,0 +1,588 @@
+#include "RttProber.h"
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <iostream>
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+namespace net {
+
+namespace {
+constexpr int kMaxEvents = 16;
+constexpr uint16_t kDefaultTcpPort = 53;    // 공용 DNS 리졸버는 모두 TCP 53을 연다
+constexpr uint16_t kDefaultUdpPort = 7;     // echo
+
+bool parsePort(std::string_view text, uint16_t& port) {
+    unsigned value = 0;
+    auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (result.ec != std::errc() || result.ptr != text.data() + text.size() || value == 0 || value > 65535) {
+        return false;
+    }
+    port = static_cast<uint16_t>(value);
+    return true;
+}
+
+uint64_t toNanoseconds(RttProber::Clock::time_point time) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count());
+}
+
+#ifndef _WIN32
+// 제어 메시지 버퍼 (scm_timestamping + sock_extended_err 여유)
+constexpr size_t kControlSize = 512;
+
+// SCM_TIMESTAMPING의 소프트웨어 타임스탬프 (ts[0]), 없으면 0
+uint64_t softwareTimestamp(const msghdr& message) {
+    for (auto* cmsg = CMSG_FIRSTHDR(&message); cmsg; cmsg = CMSG_NXTHDR(const_cast<msghdr*>(&message), cmsg)) {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPING) {
+            scm_timestamping stamps{};
+            std::memcpy(&stamps, CMSG_DATA(cmsg), sizeof(stamps));
+            return static_cast<uint64_t>(stamps.ts[0].tv_sec) * 1000000000ull
+                 + static_cast<uint64_t>(stamps.ts[0].tv_nsec);
+        }
+    }
+    return 0;
+}
+#endif
+}
+
+bool ProbeTarget::parse(std::string_view text, ProbeTarget& target) {
+    target = ProbeTarget{};
+    if (text.substr(0, 6) == "udp://") {
+        target.mode = ProbeMode::Udp;
+        target.port = kDefaultUdpPort;
+        text.remove_prefix(6);
+    } else if (text.substr(0, 6) == "tcp://") {
+        text.remove_prefix(6);
+    }
+
+    std::string_view host = text;
+    std::string_view port;
+    if (!text.empty() && text.front() == '[') {
+        // [IPv6]:port
+        auto close = text.find(']');
+        if (close == std::string_view::npos) return false;
+        host = text.substr(1, close - 1);
+        auto rest = text.substr(close + 1);
+        if (!rest.empty()) {
+            if (rest.front() != ':') return false;
+            port = rest.substr(1);
+        }
+    } else if (std::count(text.begin(), text.end(), ':') == 1) {
+        auto colon = text.find(':');
+        host = text.substr(0, colon);
+        port = text.substr(colon + 1);
+    }
+
+    if (host.empty() || (!port.empty() && !parsePort(port, target.port)) || (port.empty() && text.back() == ':')) {
+        return false;
+    }
+    target.host = std::string(host);
+    return true;
+}
+
+std::string ProbeTarget::toString() const {
+    bool v6 = host.find(':') != std::string::npos;
+    std::string text = mode == ProbeMode::Udp ? "udp://" : "";
+    text += v6 ? "[" + host + "]" : host;
+    return text + ":" + std::to_string(port);
+}
+
+RttProber::RttProber() {
+#ifndef _WIN32
+    epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd_ < 0) {
+        std::cerr << "프로브 epoll 생성 실패: " << std::strerror(errno) << std::endl;
+    }
+#endif
+}
+
+RttProber::~RttProber() {
+    for (auto& host : hosts_) {
+        closeSocket(host);
+    }
+#ifndef _WIN32
+    if (epoll_fd_ >= 0) {
+        ::close(epoll_fd_);
+    }
+#endif
+}
+
+void RttProber::closeSocket(Host& host) {
+#ifndef _WIN32
+    if (host.fd >= 0) {
+        ::close(host.fd);   // epoll 등록도 함께 빠진다
+    }
+#endif
+    host.fd = -1;
+}
+
+void RttProber::setTargets(const std::vector<ProbeTarget>& targets) {
+    for (auto& host : hosts_) {
+        closeSocket(host);
+    }
+    hosts_.clear();
+    results_.clear();
+    hosts_.resize(targets.size());
+    results_.resize(targets.size());
+    scratch_.reserve(targets.size());
+    round_ = ProbeRound{};
+
+#ifndef _WIN32
+    for (size_t i = 0; i < targets.size(); ++i) {
+        auto& host = hosts_[i];
+        host.target = targets[i];
+        results_[i].name = targets[i].toString();
+
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = targets[i].mode == ProbeMode::Udp ? SOCK_DGRAM : SOCK_STREAM;
+        hints.ai_flags = AI_NUMERICSERV;
+        addrinfo* resolved = nullptr;
+        std::string port = std::to_string(targets[i].port);
+        if (::getaddrinfo(targets[i].host.c_str(), port.c_str(), &hints, &resolved) != 0 || !resolved) {
+            std::cerr << "프로브 대상 이름 해석 실패: " << results_[i].name << std::endl;
+            continue;
+        }
+        host.family = resolved->ai_family;
+        host.address_length = static_cast<unsigned>(std::min<size_t>(resolved->ai_addrlen, sizeof(host.address)));
+        std::memcpy(host.address, resolved->ai_addr, host.address_length);
+        ::freeaddrinfo(resolved);
+        results_[i].resolved = true;
+
+        if (host.target.mode == ProbeMode::Udp) {
+            // connect해 두면 그 대상의 응답만 받고, send/recv에 주소가 필요 없다
+            host.fd = ::socket(host.family, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+            if (host.fd < 0 || ::connect(host.fd, reinterpret_cast<const sockaddr*>(host.address),
+                                         host.address_length) < 0) {
+                std::cerr << "UDP 프로브 소켓 실패: " << results_[i].name << ": " << std::strerror(errno) << std::endl;
+                closeSocket(host);
+                results_[i].resolved = false;
+                continue;
+            }
+            enableTimestamping(host);
+            epoll_event event{};
+            event.events = EPOLLIN;   // 에러 큐(TX 타임스탬프)는 EPOLLERR로 항상 알려진다
+            event.data.u64 = i;
+            ::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, host.fd, &event);
+        }
+    }
+#endif
+}
+
+void RttProber::enableTimestamping(Host& host) {
+#ifdef _WIN32
+    (void)host;
+#else
+    // 소프트웨어 TX(드라이버 송신 직전)/RX(스택 진입) 타임스탬프, TX는 페이로드 없이 ID로 구분
+    unsigned flags = SOF_TIMESTAMPING_TX_SOFTWARE | SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE
+                   | SOF_TIMESTAMPING_OPT_ID | SOF_TIMESTAMPING_OPT_TSONLY;
+    host.timestamping = ::setsockopt(host.fd, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) == 0;
+    host.tx_id = 0;
+    // 실패해도 steady_clock 측정은 그대로 동작한다
+#endif
+}
+
+void RttProber::drainErrorQueue(Host& host) {
+#ifdef _WIN32
+    (void)host;
+#else
+    alignas(cmsghdr) char control[kControlSize];
+    while (true) {
+        msghdr message{};
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+        if (::recvmsg(host.fd, &message, MSG_ERRQUEUE | MSG_DONTWAIT) < 0) {
+            break;
+        }
+        uint64_t stamp = softwareTimestamp(message);
+        for (auto* cmsg = CMSG_FIRSTHDR(&message); cmsg; cmsg = CMSG_NXTHDR(&message, cmsg)) {
+            bool recv_error = (cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR)
+                           || (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR);
+            if (!recv_error) continue;
+            sock_extended_err error{};
+            std::memcpy(&error, CMSG_DATA(cmsg), sizeof(error));
+            if (error.ee_errno != ENOMSG || error.ee_origin != SO_EE_ORIGIN_TIMESTAMPING || stamp == 0) continue;
+            // 이번 트레인의 송신 것만 (이전 라운드의 늦은 타임스탬프는 버린다)
+            for (uint32_t k = 0; k < host.train_size; ++k) {
+                auto& shot = host.train[k];
+                if (!shot.answered && shot.tx_kernel_ns == 0 && shot.tx_id == error.ee_data) {
+                    shot.tx_kernel_ns = stamp;
+                    break;
+                }
+            }
+        }
+    }
+#endif
+}
+
+const ProbeRound& RttProber::probe(std::chrono::milliseconds timeout) {
+#ifdef _WIN32
+    (void)timeout;
+#else
+    if (epoll_fd_ < 0) {
+        return round_;
+    }
+
+    // 모든 대상에 먼저 보내고 한 번에 기다린다 (대상 수와 무관하게 라운드 = timeout 이내)
+    size_t pending = 0;
+    auto start = Clock::now();
+    for (size_t i = 0; i < hosts_.size(); ++i) {
+        results_[i].replied = false;
+        results_[i].kernel_timestamped = false;
+        if (results_[i].resolved) {
+            pending += send(i);
+        }
+    }
+
+    auto deadline = start + timeout;
+    epoll_event events[kMaxEvents];
+    while (pending > 0) {
+        auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - Clock::now()).count();
+        if (remaining <= 0) break;
+        int ready = ::epoll_wait(epoll_fd_, events, kMaxEvents, static_cast<int>(remaining));
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        auto now = Clock::now();
+        for (int e = 0; e < ready; ++e) {
+            auto index = static_cast<size_t>(events[e].data.u64);
+            if (index >= hosts_.size()) continue;
+            uint32_t before = hosts_[index].outstanding;
+            receive(index, events[e].events, now);
+            pending -= before - hosts_[index].outstanding;
+        }
+    }
+
+    // 응답 없는 프로브 정리 후 이번 트레인 시퀀스를 손실 창에 확정
+    for (size_t i = 0; i < hosts_.size(); ++i) {
+        auto& host = hosts_[i];
+        results_[i].timeouts += host.outstanding;
+        host.outstanding = 0;
+        if (host.target.mode == ProbeMode::Tcp) {
+            closeSocket(host);
+        }
+        host.loss.settle();
+        results_[i].loss = host.loss.getStats();
+    }
+#endif
+    summarize();
+    return round_;
+}
+
+bool RttProber::takeInterval(size_t index, core::LatencyHistogram& out) {
+    if (index >= hosts_.size()) {
+        return false;
+    }
+    out = hosts_[index].interval;
+    hosts_[index].interval.reset();
+    return true;
+}
+
+void RttProber::setTrainLength(uint32_t length) {
+    train_length_ = std::clamp<uint32_t>(length, 1, kMaxTrain);
+}
+
+uint32_t RttProber::send(size_t index) {
+#ifdef _WIN32
+    (void)index;
+    return 0;
+#else
+    auto& host = hosts_[index];
+    auto& result = results_[index];
+
+    if (host.target.mode == ProbeMode::Udp) {
+        // 트레인: 연속 시퀀스 번호로 몰아서 보낸다
+        host.train_size = train_length_;
+        for (uint32_t k = 0; k < host.train_size; ++k) {
+            auto& shot = host.train[k];
+            shot = Shot{};
+            shot.seq = ++result.seq;
+            ++result.sent;
+            host.loss.sent(shot.seq);
+            shot.sent_at = Clock::now();
+            Payload payload{kMagic, shot.seq, toNanoseconds(shot.sent_at)};
+            if (::send(host.fd, &payload, sizeof(payload), 0) != static_cast<ssize_t>(sizeof(payload))) {
+                ++result.timeouts;   // 경로 없음 등 - 응답 없음과 같게 본다 (창에서는 손실)
+                shot.answered = true;
+                continue;
+            }
+            shot.tx_id = host.tx_id++;
+            ++host.outstanding;
+        }
+        return host.outstanding;
+    }
+
+    // TCP는 connect 한 번이 한 발 (트레인 없음)
+    host.train_size = 1;
+    auto& shot = host.train[0];
+    shot = Shot{};
+    shot.seq = ++result.seq;
+    ++result.sent;
+    host.loss.sent(shot.seq);
+    host.fd = ::socket(host.family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (host.fd < 0) {
+        ++result.timeouts;
+        return 0;
+    }
+    host.outstanding = 1;
+    shot.sent_at = Clock::now();
+    if (::connect(host.fd, reinterpret_cast<const sockaddr*>(host.address), host.address_length) == 0
+        || errno == ECONNREFUSED) {
+        host.loss.received(shot.seq);
+        answer(index, shot, Clock::now());   // 루프백 등 즉시 완료
+        return 0;
+    }
+    if (errno != EINPROGRESS) {
+        ++result.timeouts;
+        closeSocket(host);
+        return 0;
+    }
+    epoll_event event{};
+    event.events = EPOLLOUT;
+    event.data.u64 = index;
+    ::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, host.fd, &event);
+    return 1;
+#endif
+}
+
+RttProber::Shot* RttProber::findShot(Host& host, uint32_t seq) {
+    if (host.train_size == 0 || seq < host.train[0].seq || seq - host.train[0].seq >= host.train_size) {
+        return nullptr;
+    }
+    return &host.train[seq - host.train[0].seq];
+}
+
+void RttProber::receive(size_t index, uint32_t events, Clock::time_point now) {
+#ifdef _WIN32
+    (void)index;
+    (void)events;
+    (void)now;
+#else
+    auto& host = hosts_[index];
+    auto& result = results_[index];
+
+    if (host.target.mode == ProbeMode::Udp) {
+        // TX 타임스탬프는 응답보다 먼저 큐에 들어오므로 에러 큐부터 비운다
+        if (host.timestamping) {
+            drainErrorQueue(host);
+        }
+        Payload payload{};
+        alignas(cmsghdr) char control[kControlSize];
+        while (true) {
+            iovec data{&payload, sizeof(payload)};
+            msghdr message{};
+            message.msg_iov = &data;
+            message.msg_iovlen = 1;
+            message.msg_control = control;
+            message.msg_controllen = sizeof(control);
+            ssize_t n = ::recvmsg(host.fd, &message, MSG_DONTWAIT);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                break;   // EAGAIN 또는 ICMP 오류(ECONNREFUSED) - 응답으로 보지 않는다
+            }
+            if (n != static_cast<ssize_t>(sizeof(payload)) || payload.magic != kMagic) continue;
+
+            auto arrival = host.loss.received(payload.seq);
+            Shot* shot = findShot(host, payload.seq);
+            if (shot && !shot->answered && arrival != LossWindow::Arrival::Duplicate) {
+                answer(index, *shot, now, host.timestamping ? softwareTimestamp(message) : 0);
+            } else if (arrival == LossWindow::Arrival::Late || arrival == LossWindow::Arrival::Unknown) {
+                ++result.stale;   // 이전 라운드(이미 손실로 확정된) 응답
+            }
+        }
+        return;
+    }
+
+    // TCP connect 완료 - SYN-ACK(성공)이든 RST(거부)든 왕복 한 번
+    auto& shot = host.train[0];
+    if (host.outstanding == 0 || !(events & (EPOLLOUT | EPOLLERR | EPOLLHUP))) {
+        return;
+    }
+    int error = 0;
+    socklen_t length = sizeof(error);
+    ::getsockopt(host.fd, SOL_SOCKET, SO_ERROR, &error, &length);
+    if (error == 0 || error == ECONNREFUSED) {
+        host.loss.received(shot.seq);
+        answer(index, shot, now);
+    } else {
+        ++result.timeouts;   // 호스트/네트워크 도달 불가
+        host.outstanding = 0;
+        closeSocket(host);
+    }
+#endif
+}
+
+void RttProber::answer(size_t index, Shot& shot, Clock::time_point now, uint64_t rx_kernel_ns) {
+    auto& host = hosts_[index];
+    auto& result = results_[index];
+    shot.answered = true;
+    --host.outstanding;
+    ++result.received;
+    if (host.target.mode == ProbeMode::Tcp) {
+        closeSocket(host);
+    }
+
+    double user_rtt_ms = std::chrono::duration<double, std::milli>(now - shot.sent_at).count();
+    // 두 커널 시각이 모두 있을 때만 (TX 타임스탬프가 늦거나 커널이 지원하지 않으면 steady_clock)
+    bool kernel = shot.tx_kernel_ns > 0 && rx_kernel_ns > shot.tx_kernel_ns;
+    double kernel_rtt_ms = kernel ? static_cast<double>(rx_kernel_ns - shot.tx_kernel_ns) / 1e6 : 0.0;
+    double rtt_ms = kernel ? kernel_rtt_ms : user_rtt_ms;
+
+    // 지터/분포는 트레인의 모든 응답을 도착 순서대로
+    host.jitter.add(rtt_ms);
+    host.interval.record(rtt_ms);
+    result.jitter_ms = host.jitter.get();
+
+    if (result.replied) {
+        return;   // 라운드 RTT는 트레인에서 처음 도착한 응답
+    }
+    result.user_rtt_ms = user_rtt_ms;
+    result.kernel_rtt_ms = kernel_rtt_ms;
+    result.kernel_timestamped = kernel;
+    result.rtt_ms = rtt_ms;
+    result.replied = true;
+}
+
+void RttProber::summarize() {
+    round_ = ProbeRound{};
+    for (const auto& result : results_) {
+        if (result.replied) ++round_.responded;
+    }
+
+    // 전체 손실률은 호스트별 창을 합쳐서 (창 크기가 다른 호스트도 패킷 수 비중대로)
+    uint64_t window = 0;
+    uint64_t lost = 0;
+    for (const auto& result : results_) {
+        window += result.loss.window;
+        lost += result.loss.lost;
+        round_.max_burst = std::max(round_.max_burst, result.loss.max_burst);
+    }
+    if (window > 0) {
+        round_.loss_pct = 100.0 * static_cast<double>(lost) / static_cast<double>(window);
+    }
+
+    // 지터는 한 번이라도 응답한 호스트들의 중앙값 (이번 라운드 응답과 무관하게 추정치는 유지된다)
+    scratch_.clear();
+    for (size_t i = 0; i < results_.size(); ++i) {
+        if (hosts_[i].jitter.getCount() > 1) scratch_.push_back(results_[i].jitter_ms);
+    }
+    if (!scratch_.empty()) {
+        round_.jitter_ms = median(scratch_);
+    }
+
+    scratch_.clear();
+    for (const auto& result : results_) {
+        if (result.replied) scratch_.push_back(result.rtt_ms);
+    }
+    if (scratch_.empty()) {
+        return;
+    }
+    round_.min_rtt_ms = *std::min_element(scratch_.begin(), scratch_.end());
+    round_.median_rtt_ms = median(scratch_);
+
+    scratch_.clear();
+    for (const auto& result : results_) {
+        if (result.replied) scratch_.push_back(result.user_rtt_ms);
+    }
+    round_.user_rtt_ms = median(scratch_);
+
+    // 커널 타임스탬프로 잰 호스트들의 사용자 공간 지연 (스케줄링/epoll 복귀 지연)
+    scratch_.clear();
+    for (const auto& result : results_) {
+        if (result.replied && result.kernel_timestamped) {
+            scratch_.push_back(std::max(0.0, result.user_rtt_ms - result.kernel_rtt_ms));
+        }
+    }
+    round_.kernel_timestamped = scratch_.size();
+    if (!scratch_.empty()) {
+        round_.host_delay_ms = median(scratch_);
+        scratch_.clear();
+        for (const auto& result : results_) {
+            if (result.replied && result.kernel_timestamped) scratch_.push_back(result.kernel_rtt_ms);
+        }
+        round_.kernel_rtt_ms = median(scratch_);
+    }
+}
+
+double RttProber::median(std::vector<double>& values) {
+    std::sort(values.begin(), values.end());   // 대상 수는 몇 개뿐
+    size_t middle = values.size() / 2;
+    return values.size() % 2 ? values[middle] : (values[middle - 1] + values[middle]) / 2.0;
+}
+
+UdpEchoServer::~UdpEchoServer() {
+    stop();
+}
+
+bool UdpEchoServer::start(uint16_t port) {
+#ifdef _WIN32
+    (void)port;
+    return false;
+#else
+    stop();
+    fd_ = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (fd_ < 0) {
+        return false;
+    }
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    if (::bind(fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0
+        || ::getsockname(fd_, reinterpret_cast<sockaddr*>(&address), &length) < 0) {
+        std::cerr << "UDP 에코 서버 바인드 실패: " << std::strerror(errno) << std::endl;
+        ::close(fd_);
+        fd_ = -1;
+        return false;
+    }
+    port_ = ntohs(address.sin_port);
+
+    // 종료 플래그를 주기적으로 보도록 수신 타임아웃
+    timeval timeout{0, 100000};
+    ::setsockopt(fd_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    running_ = true;
+    thread_ = std::thread([this]() {
+        char buffer[2048];
+        while (running_) {
+            sockaddr_storage peer{};
+            socklen_t peer_length = sizeof(peer);
+            ssize_t n = ::recvfrom(fd_, buffer, sizeof(buffer), 0, reinterpret_cast<sockaddr*>(&peer), &peer_length);
+            if (n < 0) continue;
+            ::sendto(fd_, buffer, static_cast<size_t>(n), 0, reinterpret_cast<sockaddr*>(&peer), peer_length);
+            ++echoed_;
+        }
+    });
+    return true;
+#endif
+}
+
+void UdpEchoServer::stop() {
+    running_ = false;
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+#ifndef _WIN32
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+#endif
+}
+
+} // namespace net
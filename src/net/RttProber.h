@@ -0,0 +1,170 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "../core/LatencyHistogram.h"
+#include "JitterEstimator.h"
+#include "LossWindow.h"
+
+namespace net {
+
+// 프로브 방식 - UDP는 에코 서버가 있는 대상, TCP는 connect 왕복(SYN -> SYN-ACK/RST)
+enum class ProbeMode : uint8_t { Tcp, Udp };
+
+// "8.8.8.8" (TCP 53), "host:port" (TCP), "udp://host:port" (UDP 에코), IPv6는 "[::1]:7"
+struct ProbeTarget {
+    std::string host;
+    uint16_t port{53};
+    ProbeMode mode{ProbeMode::Tcp};
+
+    static bool parse(std::string_view text, ProbeTarget& target);
+    std::string toString() const;
+};
+
+// 호스트 하나의 최근 결과
+struct HostRtt {
+    std::string name;              // ProbeTarget::toString()
+    bool resolved{false};
+    bool replied{false};           // 이번 라운드 응답 여부
+    double rtt_ms{0};              // 이번 라운드 RTT (커널 타임스탬프가 있으면 그 값, 없으면 user_rtt_ms)
+    double user_rtt_ms{0};         // steady_clock 기준 (send 직전 ~ epoll_wait 복귀)
+    double kernel_rtt_ms{0};       // 커널 소프트웨어 TX/RX 타임스탬프 기준, 없으면 0
+    bool kernel_timestamped{false};  // 이번 라운드 RTT가 커널 타임스탬프로 측정됨
+    double jitter_ms{0};           // RFC 3550 지터 (모든 응답 반영)
+    uint32_t seq{0};               // 마지막으로 보낸 시퀀스 번호
+    uint64_t sent{0};              // 보낸 프로브 수 (트레인의 각 발 포함)
+    uint64_t received{0};
+    uint64_t timeouts{0};
+    uint64_t stale{0};             // 시간 초과 뒤 도착한 이전 시퀀스 응답
+    LossStats loss;                // 시퀀스 창 기준 손실/순서 뒤바뀜/중복/연속 손실
+};
+
+// 라운드 요약 (응답한 호스트 기준)
+struct ProbeRound {
+    size_t responded{0};
+    double min_rtt_ms{0};
+    double median_rtt_ms{0};
+    double loss_pct{0};            // 모든 호스트 손실 창 합산
+    uint32_t max_burst{0};         // 호스트별 창 안 최장 연속 손실 중 최대
+    double jitter_ms{0};           // 호스트별 지터 중앙값
+    size_t kernel_timestamped{0};  // 커널 타임스탬프로 잰 응답 수
+    double user_rtt_ms{0};         // 응답 호스트들의 steady_clock RTT 중앙값
+    double kernel_rtt_ms{0};       // 커널 타임스탬프로 잰 응답들의 커널 RTT 중앙값
+    double host_delay_ms{0};       // 그 응답들의 (user - kernel) RTT 중앙값 = 이 호스트가 더한 지연
+};
+
+// 모든 프로브 대상에 동시에 보내고 epoll 하나로 응답을 모으는 RTT 측정기
+// UDP 소켓은 대상별로 connect해 두고 재사용하며, 응답은 (매직, 시퀀스)로 이번 라운드 것인지 확인한다.
+// TCP는 라운드마다 논블로킹 connect 후 바로 닫는다 (RST도 왕복이므로 RTT로 센다).
+// UDP는 라운드마다 연속 시퀀스 번호의 트레인을 보내고, 호스트별 LossWindow로 손실/연속 손실을 잰다.
+// UDP는 SO_TIMESTAMPING 소프트웨어 타임스탬프로 송신(에러 큐)/수신(제어 메시지) 시각을 받아
+// 스케줄링 지연이 빠진 RTT를 함께 잰다. user_rtt_ms - kernel_rtt_ms = 호스트에서 생긴 지연.
+class RttProber {
+public:
+    using Clock = std::chrono::steady_clock;
+    static constexpr uint32_t kMaxTrain = 16;
+
+    RttProber();
+    ~RttProber();
+
+    // 대상 교체 (이름 해석은 여기서 한 번만)
+    void setTargets(const std::vector<ProbeTarget>& targets);
+
+    // UDP 대상에 라운드마다 보낼 프로브 수 (1 ~ kMaxTrain, TCP는 항상 1)
+    void setTrainLength(uint32_t length);
+    uint32_t getTrainLength() const { return train_length_; }
+
+    // 한 라운드 실행 - 모든 대상에 보내고 timeout까지 응답을 기다린다
+    const ProbeRound& probe(std::chrono::milliseconds timeout);
+
+    const ProbeRound& getRound() const { return round_; }
+    const std::vector<HostRtt>& getHosts() const { return results_; }
+
+    // 마지막으로 가져간 뒤 쌓인 호스트별 RTT 분포 (모든 응답), out에 복사하고 비운다
+    bool takeInterval(size_t index, core::LatencyHistogram& out);
+
+    // UDP 에코 페이로드 (테스트/에코 서버용 공개)
+    struct Payload {
+        uint32_t magic;
+        uint32_t seq;
+        uint64_t sent_ns;
+    };
+    static constexpr uint32_t kMagic = 0x4c4f5331;   // "LOS1"
+
+private:
+    RttProber(const RttProber&) = delete;
+    RttProber& operator=(const RttProber&) = delete;
+
+    // 트레인 안의 프로브 한 발
+    struct Shot {
+        uint32_t seq{0};
+        uint32_t tx_id{0};            // SOF_TIMESTAMPING_OPT_ID 값
+        Clock::time_point sent_at{};
+        uint64_t tx_kernel_ns{0};     // 커널 송신 시각 (CLOCK_REALTIME), 0 = 아직 없음
+        bool answered{false};
+    };
+
+    struct Host {
+        ProbeTarget target;
+        int family{0};
+        alignas(8) unsigned char address[128]{};   // sockaddr_storage
+        unsigned address_length{0};
+        int fd{-1};                   // UDP: 계속 유지, TCP: 라운드마다 새로
+        bool timestamping{false};     // SO_TIMESTAMPING 설정 성공 (UDP)
+        uint32_t tx_id{0};            // 성공한 send 수 = 다음 TX 타임스탬프 ID
+        std::array<Shot, kMaxTrain> train{};
+        uint32_t train_size{0};       // 이번 라운드에 보낸 발 수
+        uint32_t outstanding{0};      // 응답 대기 중인 발 수
+        LossWindow loss;
+        JitterEstimator jitter;
+        core::LatencyHistogram interval;   // takeInterval 이후 RTT
+    };
+
+    // 이번 라운드 트레인 전송, 응답을 기다릴 발 수 반환
+    uint32_t send(size_t index);
+    void receive(size_t index, uint32_t events, Clock::time_point now);
+    void answer(size_t index, Shot& shot, Clock::time_point now, uint64_t rx_kernel_ns = 0);
+    static Shot* findShot(Host& host, uint32_t seq);
+    void enableTimestamping(Host& host);
+    void drainErrorQueue(Host& host);
+    void closeSocket(Host& host);
+    void summarize();
+    static double median(std::vector<double>& values);
+
+    int epoll_fd_{-1};
+    std::vector<Host> hosts_;
+    std::vector<HostRtt> results_;
+    std::vector<double> scratch_;
+    ProbeRound round_;
+    uint32_t train_length_{1};
+};
+
+// 루프백 테스트용 UDP 에코 서버 (받은 데이터그램을 그대로 돌려준다)
+class UdpEchoServer {
+public:
+    UdpEchoServer() = default;
+    ~UdpEchoServer();
+
+    // port 0이면 임의 포트, 실제 포트는 getPort()
+    bool start(uint16_t port = 0);
+    void stop();
+    uint16_t getPort() const { return port_; }
+    uint64_t getEchoed() const { return echoed_; }
+
+private:
+    UdpEchoServer(const UdpEchoServer&) = delete;
+    UdpEchoServer& operator=(const UdpEchoServer&) = delete;
+
+    int fd_{-1};
+    uint16_t port_{0};
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> echoed_{0};
+    std::thread thread_;
+};
+
+} // namespace net
@@ -31,6 +31,7 @@ AlertManager::~AlertManager() = default;
 
 void AlertManager::setThresholds(const AlertThresholds& thresholds) {
     thresholds_ = thresholds;
+    recording_stall_.setThreshold(std::chrono::seconds(thresholds_.recording_stall_seconds));
 }
 
 AlertThresholds AlertManager::getThresholds() const {
@@ -51,6 +52,20 @@ void AlertManager::updateMetrics(const json& metrics) {
     // OBS 임계값 체크
     checkObsThresholds(metrics);
     
+    resetViolationCounters();
+}
+
+void AlertManager::updateMetrics(const core::MetricFrame& frame) {
+    // 레지스트리 슬롯에서 바로 읽음 (키 조회 없음)
+    checkRtt(frame[core::MetricId::RttMs]);
+    checkLoss(frame[core::MetricId::LossPct]);
+    checkCpu(frame[core::MetricId::CpuPct]);
+    checkGpu(frame[core::MetricId::GpuPct]);
+    
+    resetViolationCounters();
+}
+
+void AlertManager::resetViolationCounters() {
     // 연속 초과 카운터 리셋 (hold_seconds 후)
     auto now = std::chrono::steady_clock::now();
     if (now - violation_counter_.last_reset > std::chrono::seconds(thresholds_.hold_seconds)) {
@@ -136,52 +151,12 @@ void AlertManager::checkNetworkThresholds(const json& metrics) {
     
     // RTT 체크
     if (network.contains("rtt_ms")) {
-        double rtt = network["rtt_ms"];
-        
-        if (rtt > thresholds_.rtt_ms_critical) {
-            violation_counter_.rtt_count++;
-            if (violation_counter_.rtt_count >= thresholds_.hold_seconds) {
-                createAlert(AlertLevel::CRITICAL, "Network RTT Critical", 
-                           "RTT is " + std::to_string(static_cast<int>(rtt)) + "ms (threshold: " + 
-                           std::to_string(static_cast<int>(thresholds_.rtt_ms_critical)) + "ms)", 
-                           "network", {{"rtt_ms", rtt}});
-            }
-        } else if (rtt > thresholds_.rtt_ms_warning) {
-            violation_counter_.rtt_count++;
-            if (violation_counter_.rtt_count >= thresholds_.hold_seconds) {
-                createAlert(AlertLevel::WARNING, "Network RTT Warning", 
-                           "RTT is " + std::to_string(static_cast<int>(rtt)) + "ms (threshold: " + 
-                           std::to_string(static_cast<int>(thresholds_.rtt_ms_warning)) + "ms)", 
-                           "network", {{"rtt_ms", rtt}});
-            }
-        } else {
-            violation_counter_.rtt_count = 0;
-        }
+        checkRtt(network["rtt_ms"].get<double>());
     }
     
     // 패킷 손실 체크
     if (network.contains("loss_pct")) {
-        double loss = network["loss_pct"];
-        
-        if (loss > thresholds_.loss_pct_critical) {
-            violation_counter_.loss_count++;
-            if (violation_counter_.loss_count >= thresholds_.hold_seconds) {
-                createAlert(AlertLevel::CRITICAL, "Network Packet Loss Critical", 
-                           "Packet loss is " + std::to_string(loss) + "% (threshold: " + 
-                           std::to_string(thresholds_.loss_pct_critical) + "%)", 
-                           "network", {{"loss_pct", loss}});
-            }
-        } else if (loss > thresholds_.loss_pct_warning) {
-            violation_counter_.loss_count++;
-            if (violation_counter_.loss_count >= thresholds_.hold_seconds) {
-                createAlert(AlertLevel::WARNING, "Network Packet Loss Warning", 
-                           "Packet loss is " + std::to_string(loss) + "% (threshold: " + 
-                           std::to_string(thresholds_.loss_pct_warning) + "%)", 
-                           "network", {{"loss_pct", loss}});
-            }
-        } else {
-            violation_counter_.loss_count = 0;
-        }
+        checkLoss(network["loss_pct"].get<double>());
     }
 }
 
@@ -192,52 +167,100 @@ void AlertManager::checkSystemThresholds(const json& metrics) {
     
     // CPU 사용률 체크
     if (system.contains("cpu_pct")) {
-        double cpu = system["cpu_pct"];
-        
-        if (cpu > thresholds_.cpu_pct_critical) {
-            violation_counter_.cpu_count++;
-            if (violation_counter_.cpu_count >= thresholds_.hold_seconds) {
-                createAlert(AlertLevel::CRITICAL, "CPU Usage Critical", 
-                           "CPU usage is " + std::to_string(static_cast<int>(cpu)) + "% (threshold: " + 
-                           std::to_string(static_cast<int>(thresholds_.cpu_pct_critical)) + "%)", 
-                           "system", {{"cpu_pct", cpu}});
-            }
-        } else if (cpu > thresholds_.cpu_pct_warning) {
-            violation_counter_.cpu_count++;
-            if (violation_counter_.cpu_count >= thresholds_.hold_seconds) {
-                createAlert(AlertLevel::WARNING, "CPU Usage Warning", 
-                           "CPU usage is " + std::to_string(static_cast<int>(cpu)) + "% (threshold: " + 
-                           std::to_string(static_cast<int>(thresholds_.cpu_pct_warning)) + "%)", 
-                           "system", {{"cpu_pct", cpu}});
-            }
-        } else {
-            violation_counter_.cpu_count = 0;
-        }
+        checkCpu(system["cpu_pct"].get<double>());
     }
     
     // GPU 사용률 체크
     if (system.contains("gpu_pct")) {
-        double gpu = system["gpu_pct"];
-        
-        if (gpu > thresholds_.gpu_pct_critical) {
-            violation_counter_.gpu_count++;
-            if (violation_counter_.gpu_count >= thresholds_.hold_seconds) {
-                createAlert(AlertLevel::CRITICAL, "GPU Usage Critical", 
-                           "GPU usage is " + std::to_string(static_cast<int>(gpu)) + "% (threshold: " + 
-                           std::to_string(static_cast<int>(thresholds_.gpu_pct_critical)) + "%)", 
-                           "system", {{"gpu_pct", gpu}});
-            }
-        } else if (gpu > thresholds_.gpu_pct_warning) {
-            violation_counter_.gpu_count++;
-            if (violation_counter_.gpu_count >= thresholds_.hold_seconds) {
-                createAlert(AlertLevel::WARNING, "GPU Usage Warning", 
-                           "GPU usage is " + std::to_string(static_cast<int>(gpu)) + "% (threshold: " + 
-                           std::to_string(static_cast<int>(thresholds_.gpu_pct_warning)) + "%)", 
-                           "system", {{"gpu_pct", gpu}});
-            }
-        } else {
-            violation_counter_.gpu_count = 0;
+        checkGpu(system["gpu_pct"].get<double>());
+    }
+}
+
+void AlertManager::checkRtt(double rtt) {
+    if (rtt > thresholds_.rtt_ms_critical) {
+        violation_counter_.rtt_count++;
+        if (violation_counter_.rtt_count >= thresholds_.hold_seconds) {
+            createAlert(AlertLevel::CRITICAL, "Network RTT Critical", 
+                       "RTT is " + std::to_string(static_cast<int>(rtt)) + "ms (threshold: " + 
+                       std::to_string(static_cast<int>(thresholds_.rtt_ms_critical)) + "ms)", 
+                       "network", {{"rtt_ms", rtt}});
+        }
+    } else if (rtt > thresholds_.rtt_ms_warning) {
+        violation_counter_.rtt_count++;
+        if (violation_counter_.rtt_count >= thresholds_.hold_seconds) {
+            createAlert(AlertLevel::WARNING, "Network RTT Warning", 
+                       "RTT is " + std::to_string(static_cast<int>(rtt)) + "ms (threshold: " + 
+                       std::to_string(static_cast<int>(thresholds_.rtt_ms_warning)) + "ms)", 
+                       "network", {{"rtt_ms", rtt}});
         }
+    } else {
+        violation_counter_.rtt_count = 0;
+    }
+}
+
+void AlertManager::checkLoss(double loss) {
+    if (loss > thresholds_.loss_pct_critical) {
+        violation_counter_.loss_count++;
+        if (violation_counter_.loss_count >= thresholds_.hold_seconds) {
+            createAlert(AlertLevel::CRITICAL, "Network Packet Loss Critical", 
+                       "Packet loss is " + std::to_string(loss) + "% (threshold: " + 
+                       std::to_string(thresholds_.loss_pct_critical) + "%)", 
+                       "network", {{"loss_pct", loss}});
+        }
+    } else if (loss > thresholds_.loss_pct_warning) {
+        violation_counter_.loss_count++;
+        if (violation_counter_.loss_count >= thresholds_.hold_seconds) {
+            createAlert(AlertLevel::WARNING, "Network Packet Loss Warning", 
+                       "Packet loss is " + std::to_string(loss) + "% (threshold: " + 
+                       std::to_string(thresholds_.loss_pct_warning) + "%)", 
+                       "network", {{"loss_pct", loss}});
+        }
+    } else {
+        violation_counter_.loss_count = 0;
+    }
+}
+
+void AlertManager::checkCpu(double cpu) {
+    if (cpu > thresholds_.cpu_pct_critical) {
+        violation_counter_.cpu_count++;
+        if (violation_counter_.cpu_count >= thresholds_.hold_seconds) {
+            createAlert(AlertLevel::CRITICAL, "CPU Usage Critical", 
+                       "CPU usage is " + std::to_string(static_cast<int>(cpu)) + "% (threshold: " + 
+                       std::to_string(static_cast<int>(thresholds_.cpu_pct_critical)) + "%)", 
+                       "system", {{"cpu_pct", cpu}});
+        }
+    } else if (cpu > thresholds_.cpu_pct_warning) {
+        violation_counter_.cpu_count++;
+        if (violation_counter_.cpu_count >= thresholds_.hold_seconds) {
+            createAlert(AlertLevel::WARNING, "CPU Usage Warning", 
+                       "CPU usage is " + std::to_string(static_cast<int>(cpu)) + "% (threshold: " + 
+                       std::to_string(static_cast<int>(thresholds_.cpu_pct_warning)) + "%)", 
+                       "system", {{"cpu_pct", cpu}});
+        }
+    } else {
+        violation_counter_.cpu_count = 0;
+    }
+}
+
+void AlertManager::checkGpu(double gpu) {
+    if (gpu > thresholds_.gpu_pct_critical) {
+        violation_counter_.gpu_count++;
+        if (violation_counter_.gpu_count >= thresholds_.hold_seconds) {
+            createAlert(AlertLevel::CRITICAL, "GPU Usage Critical", 
+                       "GPU usage is " + std::to_string(static_cast<int>(gpu)) + "% (threshold: " + 
+                       std::to_string(static_cast<int>(thresholds_.gpu_pct_critical)) + "%)", 
+                       "system", {{"gpu_pct", gpu}});
+        }
+    } else if (gpu > thresholds_.gpu_pct_warning) {
+        violation_counter_.gpu_count++;
+        if (violation_counter_.gpu_count >= thresholds_.hold_seconds) {
+            createAlert(AlertLevel::WARNING, "GPU Usage Warning", 
+                       "GPU usage is " + std::to_string(static_cast<int>(gpu)) + "% (threshold: " + 
+                       std::to_string(static_cast<int>(thresholds_.gpu_pct_warning)) + "%)", 
+                       "system", {{"gpu_pct", gpu}});
+        }
+    } else {
+        violation_counter_.gpu_count = 0;
     }
 }
 
@@ -286,6 +309,11 @@ void AlertManager::checkObsThresholds(const json& metrics) {
         }
     }
     
+    if (obs.contains("recording") && obs.contains("write_bytes_per_sec")) {
+        checkRecordingWrites(obs["recording"].get<bool>(), obs.value("io_active", false),
+                             obs["write_bytes_per_sec"].get<double>());
+    }
+    
     if (obs.contains("render_lag_ms")) {
         double render_lag = obs["render_lag_ms"];
         if (render_lag > 30.0) { // 30ms 이상이면 경고
@@ -296,6 +324,19 @@ void AlertManager::checkObsThresholds(const json& metrics) {
     }
 }
 
+void AlertManager::checkRecordingWrites(bool recording, bool io_active, double write_bytes_per_sec) {
+    // 호출 횟수가 아니라 정체가 시작된 시각부터의 경과 시간으로 판단
+    auto now = std::chrono::steady_clock::now();
+    if (recording_stall_.update(recording, io_active, write_bytes_per_sec, now)) {
+        auto stall_seconds = std::chrono::duration<double>(recording_stall_.stalledFor(now)).count();
+        createAlert(AlertLevel::CRITICAL, "OBS Recording Stalled",
+                   "OBS is recording but has written nothing to disk for " +
+                   std::to_string(static_cast<int>(stall_seconds)) + "s",
+                   "obs", {{"write_bytes_per_sec", write_bytes_per_sec},
+                           {"stall_seconds", stall_seconds}});
+    }
+}
+
 bool AlertManager::isDuplicateAlert(const Alert& alert) const {
     auto now = std::chrono::system_clock::now();
     auto five_minutes_ago = now - std::chrono::minutes(5);
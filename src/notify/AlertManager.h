@@ -4,6 +4,8 @@
 #include <functional>
 #include <chrono>
 #include <nlohmann/json.hpp>
+#include "../core/MetricRegistry.h"
+#include "../sys/RecordingStall.h"
 
 using json = nlohmann::json;
 
@@ -34,6 +36,7 @@ struct AlertThresholds {
     double dropped_ratio_warning{0.03};
     double dropped_ratio_critical{0.08};
     int hold_seconds{5}; // 연속 초과 시에만 알림
+    int recording_stall_seconds{3}; // 녹화 중 쓰기 0이 이만큼 이어지면 알림
 };
 
 class AlertManager {
@@ -50,6 +53,7 @@ public:
     
     // 메트릭 업데이트 및 알림 생성
     void updateMetrics(const json& metrics);
+    void updateMetrics(const core::MetricFrame& frame);
     
     // 최근 알림 조회
     std::vector<Alert> getRecentAlerts(int count = 10) const;
@@ -74,6 +78,9 @@ private:
         int dropped_count{0};
         std::chrono::steady_clock::time_point last_reset{std::chrono::steady_clock::now()};
     } violation_counter_;
+
+    // 녹화 중 쓰기 정체 (hold 리셋과 무관 - 쓰기가 재개될 때만 초기화)
+    sys::RecordingStallDetector recording_stall_;
     
     // 알림 생성 헬퍼
     void createAlert(AlertLevel level, const std::string& title, const std::string& message, 
@@ -84,6 +91,14 @@ private:
     void checkSystemThresholds(const json& metrics);
     void checkObsThresholds(const json& metrics);
     
+    // 개별 메트릭 임계값 체크 (json/MetricFrame 경로 공용)
+    void checkRtt(double rtt);
+    void checkLoss(double loss);
+    void checkCpu(double cpu);
+    void checkGpu(double gpu);
+    void checkRecordingWrites(bool recording, bool io_active, double write_bytes_per_sec);
+    void resetViolationCounters();
+    
     // 알림 중복 방지
     bool isDuplicateAlert(const Alert& alert) const;
 };
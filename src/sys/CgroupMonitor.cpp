@@ -0,0 +1,220 @@
+#include "CgroupMonitor.h"
+#include <charconv>
+#include <filesystem>
+#include <thread>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace sys {
+
+namespace {
+// "key=value" 단어 분리
+bool splitPair(std::string_view word, std::string_view& key, uint64_t& value) {
+    auto eq = word.find('=');
+    if (eq == std::string_view::npos) return false;
+    key = word.substr(0, eq);
+    auto digits = word.substr(eq + 1);
+    auto result = std::from_chars(digits.data(), digits.data() + digits.size(), value);
+    return result.ec == std::errc() && result.ptr == digits.data() + digits.size();
+}
+
+double onlineCpus() {
+    unsigned count = std::thread::hardware_concurrency();
+    return count > 0 ? static_cast<double>(count) : 1.0;
+}
+
+uint64_t physicalMemory() {
+#ifdef _WIN32
+    return 0;
+#else
+    long pages = sysconf(_SC_PHYS_PAGES);
+    long page_size = sysconf(_SC_PAGESIZE);
+    return pages > 0 && page_size > 0 ? static_cast<uint64_t>(pages) * static_cast<uint64_t>(page_size) : 0;
+#endif
+}
+}
+
+std::string cgroupPathOf(std::string_view proc_self_cgroup) {
+    ProcScanner scanner(proc_self_cgroup);
+    while (!scanner.atEnd()) {
+        if (scanner.expect("0::")) {
+            return std::string(scanner.word());
+        }
+        scanner.nextLine();
+    }
+    return {};
+}
+
+std::string findCgroupDir(const std::string& root, const std::string& proc_self_cgroup) {
+    ProcFile file(proc_self_cgroup);
+    auto path = cgroupPathOf(file.read());
+    if (path.empty()) {
+        return {};
+    }
+
+    // 하이브리드 계층(systemd)에서는 v2가 <root>/unified에 마운트된다
+    std::string base = root;
+    std::error_code ec;
+    if (!std::filesystem::exists(root + "/cgroup.controllers", ec)
+        && std::filesystem::exists(root + "/unified/cgroup.controllers", ec)) {
+        base = root + "/unified";
+    }
+
+    std::string dir = base + path;
+    while (dir.size() > 1 && dir.back() == '/') {
+        dir.pop_back();
+    }
+    return dir;
+}
+
+CgroupMonitor::CgroupMonitor(std::string dir)
+    : dir_(std::move(dir))
+    , cpu_stat_(dir_ + "/cpu.stat")
+    , cpu_max_(dir_ + "/cpu.max")
+    , memory_current_(dir_ + "/memory.current")
+    , memory_max_(dir_ + "/memory.max")
+    , memory_stat_(dir_ + "/memory.stat")
+    , io_stat_(dir_ + "/io.stat") {}
+
+std::unique_ptr<CgroupMonitor> CgroupMonitor::forSelf(const std::string& root, const std::string& proc_self_cgroup) {
+    auto dir = findCgroupDir(root, proc_self_cgroup);
+    if (dir.empty()) {
+        return nullptr;
+    }
+    return std::make_unique<CgroupMonitor>(dir);
+}
+
+bool CgroupMonitor::sample(Clock::time_point now) {
+    if (dir_.empty()) return false;
+
+    // cpu.stat은 cgroup v2 필수 파일 - 없으면 v2 cgroup이 아님
+    CgroupCounters counters;
+    if (!parseCpuStat(cpu_stat_.read(), counters)) {
+        valid_ = false;
+        return false;
+    }
+    // io 컨트롤러가 꺼져 있으면 io.stat이 없다 (0으로 유지)
+    parseIoStat(io_stat_.read(), counters);
+
+    // 한도: 없으면("max") 호스트 전체를 한도로 본다
+    if (!parseCpuMax(cpu_max_.read(), usage_.cpu_limit_cores)) {
+        usage_.cpu_limit_cores = onlineCpus();
+    }
+    if (!parseMemoryValue(memory_max_.read(), usage_.mem_limit)) {
+        usage_.mem_limit = physicalMemory();
+    }
+
+    parseMemoryValue(memory_current_.read(), usage_.mem_current);
+    uint64_t inactive_file = parseInactiveFile(memory_stat_.read());
+    usage_.mem_working_set = usage_.mem_current > inactive_file ? usage_.mem_current - inactive_file : 0;
+    usage_.mem_pct = usage_.mem_limit > 0
+        ? static_cast<double>(usage_.mem_working_set) / static_cast<double>(usage_.mem_limit) * 100.0 : 0.0;
+
+    if (primed_) {
+        double elapsed_us = std::chrono::duration<double, std::micro>(now - last_time_).count();
+        if (elapsed_us > 0) {
+            double seconds = elapsed_us / 1e6;
+            usage_.cpu_cores = counterDelta(last_.usage_usec, counters.usage_usec) / elapsed_us;
+            usage_.cpu_pct = usage_.cpu_cores / usage_.cpu_limit_cores * 100.0;
+
+            uint64_t periods = counterDelta(last_.nr_periods, counters.nr_periods);
+            uint64_t throttled = counterDelta(last_.nr_throttled, counters.nr_throttled);
+            usage_.throttled_pct = periods > 0 ? static_cast<double>(throttled) / periods * 100.0 : 0.0;
+            usage_.throttled_usec = counterDelta(last_.throttled_usec, counters.throttled_usec);
+
+            usage_.io_read_bps = counterDelta(last_.io_rbytes, counters.io_rbytes) / seconds;
+            usage_.io_write_bps = counterDelta(last_.io_wbytes, counters.io_wbytes) / seconds;
+            usage_.io_read_iops = counterDelta(last_.io_rios, counters.io_rios) / seconds;
+            usage_.io_write_iops = counterDelta(last_.io_wios, counters.io_wios) / seconds;
+            valid_ = true;
+        }
+    }
+
+    last_ = counters;
+    last_time_ = now;
+    primed_ = true;
+    return valid_;
+}
+
+bool CgroupMonitor::parseCpuStat(std::string_view text, CgroupCounters& counters) {
+    ProcScanner scanner(text);
+    bool has_usage = false;
+
+    while (!scanner.atEnd()) {
+        auto key = scanner.word();
+        uint64_t value = 0;
+        if (scanner.number(value)) {
+            if (key == "usage_usec") {
+                counters.usage_usec = value;
+                has_usage = true;
+            } else if (key == "user_usec") {
+                counters.user_usec = value;
+            } else if (key == "system_usec") {
+                counters.system_usec = value;
+            } else if (key == "nr_periods") {
+                counters.nr_periods = value;
+            } else if (key == "nr_throttled") {
+                counters.nr_throttled = value;
+            } else if (key == "throttled_usec") {
+                counters.throttled_usec = value;
+            }
+        }
+        scanner.nextLine();
+    }
+    return has_usage;
+}
+
+bool CgroupMonitor::parseIoStat(std::string_view text, CgroupCounters& counters) {
+    // "8:0 rbytes=1 wbytes=2 rios=3 wios=4 dbytes=0 dios=0" - 장치별 한 줄, 합산
+    ProcScanner scanner(text);
+    bool any = false;
+
+    while (!scanner.atEnd()) {
+        scanner.word();  // major:minor
+        for (auto word = scanner.word(); !word.empty(); word = scanner.word()) {
+            std::string_view key;
+            uint64_t value = 0;
+            if (!splitPair(word, key, value)) continue;
+            if (key == "rbytes") counters.io_rbytes += value;
+            else if (key == "wbytes") counters.io_wbytes += value;
+            else if (key == "rios") counters.io_rios += value;
+            else if (key == "wios") counters.io_wios += value;
+            any = true;
+        }
+        scanner.nextLine();
+    }
+    return any;
+}
+
+bool CgroupMonitor::parseCpuMax(std::string_view text, double& cores) {
+    // "<quota> <period>" 또는 "max <period>"
+    ProcScanner scanner(text);
+    uint64_t quota = 0;
+    uint64_t period = 0;
+    if (!scanner.number(quota) || !scanner.number(period) || period == 0) {
+        return false;
+    }
+    cores = static_cast<double>(quota) / static_cast<double>(period);
+    return true;
+}
+
+bool CgroupMonitor::parseMemoryValue(std::string_view text, uint64_t& bytes) {
+    ProcScanner scanner(text);
+    return scanner.number(bytes);
+}
+
+uint64_t CgroupMonitor::parseInactiveFile(std::string_view text) {
+    ProcScanner scanner(text);
+    while (!scanner.atEnd()) {
+        if (scanner.word() == "inactive_file") {
+            uint64_t value = 0;
+            return scanner.number(value) ? value : 0;
+        }
+        scanner.nextLine();
+    }
+    return 0;
+}
+
+} // namespace sys
@@ -0,0 +1,100 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include "ProcFile.h"
+
+namespace sys {
+
+// /proc/self/cgroup 텍스트에서 cgroup v2 경로 ("0::/경로" 줄), 없으면 빈 문자열
+std::string cgroupPathOf(std::string_view proc_self_cgroup);
+
+// <root>/<자기 cgroup 경로>, v2 항목이 없으면 빈 문자열
+std::string findCgroupDir(const std::string& root = "/sys/fs/cgroup",
+                          const std::string& proc_self_cgroup = "/proc/self/cgroup");
+
+// cgroup 누적 카운터 (cpu.stat / io.stat 합계)
+struct CgroupCounters {
+    uint64_t usage_usec{0};
+    uint64_t user_usec{0};
+    uint64_t system_usec{0};
+    uint64_t nr_periods{0};
+    uint64_t nr_throttled{0};
+    uint64_t throttled_usec{0};
+    uint64_t io_rbytes{0};
+    uint64_t io_wbytes{0};
+    uint64_t io_rios{0};
+    uint64_t io_wios{0};
+};
+
+// cgroup 한도 대비 사용률
+struct CgroupUsage {
+    double cpu_limit_cores{0};      // cpu.max 쿼터 (없으면 온라인 CPU 수)
+    double cpu_cores{0};            // 샘플 사이 평균 사용 코어 수
+    double cpu_pct{0};              // cpu_cores / cpu_limit_cores
+    double throttled_pct{0};        // 스로틀된 주기 비율
+    uint64_t throttled_usec{0};     // 샘플 사이 스로틀 시간
+
+    uint64_t mem_current{0};        // memory.current (bytes)
+    uint64_t mem_working_set{0};    // current - inactive_file (kubelet과 같은 기준)
+    uint64_t mem_limit{0};          // memory.max (없으면 물리 메모리)
+    double mem_pct{0};              // working_set / limit
+
+    double io_read_bps{0};
+    double io_write_bps{0};
+    double io_read_iops{0};
+    double io_write_iops{0};
+};
+
+// cgroup v2 자원 수집기
+// 컨테이너 안에서는 sysinfo()/statvfs()가 호스트 전체 값을 돌려주므로,
+// 자기 cgroup의 cpu.stat / cpu.max / memory.* / io.stat으로 한도 대비 사용률을 계산한다.
+// root를 바꾸면 테스트에서 가짜 cgroupfs 트리를 가리킬 수 있다.
+class CgroupMonitor {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // dir: cgroup 디렉터리 (빈 문자열이면 수집 안 함)
+    explicit CgroupMonitor(std::string dir);
+
+    // 자기 cgroup을 찾아 생성
+    static std::unique_ptr<CgroupMonitor> forSelf(const std::string& root = "/sys/fs/cgroup",
+                                                  const std::string& proc_self_cgroup = "/proc/self/cgroup");
+
+    // 새 샘플, 비율이 유효하면(두 번째 샘플부터) true
+    bool sample() { return sample(Clock::now()); }
+    bool sample(Clock::time_point now);
+
+    const CgroupUsage& getUsage() const { return usage_; }
+    const std::string& getDir() const { return dir_; }
+    bool isValid() const { return valid_; }
+
+    // 파일 내용 파싱 (테스트용 공개)
+    static bool parseCpuStat(std::string_view text, CgroupCounters& counters);
+    static bool parseIoStat(std::string_view text, CgroupCounters& counters);
+    static bool parseCpuMax(std::string_view text, double& cores);        // "max" 이면 false
+    static bool parseMemoryValue(std::string_view text, uint64_t& bytes);  // "max" 이면 false
+    static uint64_t parseInactiveFile(std::string_view text);
+
+private:
+    CgroupMonitor(const CgroupMonitor&) = delete;
+    CgroupMonitor& operator=(const CgroupMonitor&) = delete;
+
+    std::string dir_;
+    ProcFile cpu_stat_;
+    ProcFile cpu_max_;
+    ProcFile memory_current_;
+    ProcFile memory_max_;
+    ProcFile memory_stat_;
+    ProcFile io_stat_;
+
+    CgroupCounters last_;
+    Clock::time_point last_time_{};
+    bool primed_{false};
+    bool valid_{false};
+    CgroupUsage usage_;
+};
+
+} // namespace sys
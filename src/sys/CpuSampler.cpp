@@ -0,0 +1,165 @@
+#include "CpuSampler.h"
+#include <algorithm>
+
+namespace sys {
+
+void CoreCounters::resize(size_t count) {
+    busy.resize(count);
+    idle.resize(count);
+    iowait.resize(count);
+    steal.resize(count);
+}
+
+void CoreUsage::resize(size_t count) {
+    busy_pct.resize(count);
+    iowait_pct.resize(count);
+    steal_pct.resize(count);
+}
+
+void computeCoreUsage(const CoreCounters& prev, const CoreCounters& cur, CoreUsage& out) {
+    const size_t count = std::min(prev.size(), cur.size());
+    out.resize(count);
+
+    const uint64_t* __restrict busy0 = prev.busy.data();
+    const uint64_t* __restrict idle0 = prev.idle.data();
+    const uint64_t* __restrict wait0 = prev.iowait.data();
+    const uint64_t* __restrict steal0 = prev.steal.data();
+    const uint64_t* __restrict busy1 = cur.busy.data();
+    const uint64_t* __restrict idle1 = cur.idle.data();
+    const uint64_t* __restrict wait1 = cur.iowait.data();
+    const uint64_t* __restrict steal1 = cur.steal.data();
+    float* __restrict busy_pct = out.busy_pct.data();
+    float* __restrict wait_pct = out.iowait_pct.data();
+    float* __restrict steal_pct = out.steal_pct.data();
+
+    // 샘플 간 차이는 32비트에 충분히 들어가므로 int32로 좁혀 float 변환까지 SIMD로 처리
+    // 카운터가 되감기면(일부 커널의 iowait) 부호 비트 마스크로 0 클램프 - 루프 안에 분기 없음
+    auto delta = [](uint64_t before, uint64_t after) {
+        auto d = static_cast<int32_t>(after - before);
+        return d & ~(d >> 31);
+    };
+
+    for (size_t i = 0; i < count; ++i) {
+        int32_t busy = delta(busy0[i], busy1[i]);
+        int32_t idle = delta(idle0[i], idle1[i]);
+        int32_t wait = delta(wait0[i], wait1[i]);
+        int32_t steal = delta(steal0[i], steal1[i]);
+
+        // 경과 jiffies가 0이면 모든 차이가 0이므로 결과도 0
+        float scale = 100.0f / static_cast<float>(std::max(busy + idle + wait + steal, 1));
+
+        busy_pct[i] = static_cast<float>(busy + steal) * scale;
+        wait_pct[i] = static_cast<float>(wait) * scale;
+        steal_pct[i] = static_cast<float>(steal) * scale;
+    }
+}
+
+CpuSampler::CpuSampler(std::string path, std::chrono::milliseconds min_interval)
+    : file_(std::move(path))
+    , min_interval_(min_interval) {}
+
+bool CpuSampler::sample() {
+    auto now = Clock::now();
+    if (primed_ && now - last_sample_ < min_interval_) {
+        // jiffies 해상도(보통 10ms)보다 짧은 간격의 차이는 잡음뿐
+        return valid_;
+    }
+    last_sample_ = now;
+
+    auto text = file_.read();
+    if (text.empty()) {
+        return false;
+    }
+    return update(text);
+}
+
+bool CpuSampler::update(std::string_view text) {
+    if (!parse(text, cur_total_, cur_cores_)) {
+        return false;
+    }
+
+    // 코어 수가 바뀌면(핫플러그) 기준 샘플부터 다시 시작
+    if (!primed_ || cur_cores_.size() != prev_cores_.size()) {
+        prev_total_ = cur_total_;
+        prev_cores_ = cur_cores_;
+        cores_.resize(cur_cores_.size());
+        primed_ = true;
+        valid_ = false;
+        return false;
+    }
+
+    // 경과 jiffies가 0이면 직전 비율 유지
+    if (cur_total_.total() == prev_total_.total()) {
+        return valid_;
+    }
+
+    total_ = usageBetween(prev_total_, cur_total_);
+    computeCoreUsage(prev_cores_, cur_cores_, cores_);
+
+    std::swap(prev_total_, cur_total_);
+    std::swap(prev_cores_, cur_cores_);
+    valid_ = true;
+    return true;
+}
+
+bool CpuSampler::parse(std::string_view text, CpuTimes& total, CoreCounters& cores) {
+    ProcScanner scanner(text);
+    bool has_total = false;
+    size_t core_count = 0;
+    CpuTimes times;
+
+    // cpu 줄들은 파일 맨 앞에 연속으로 나온다
+    while (!scanner.atEnd() && scanner.startsWith("cpu")) {
+        auto label = scanner.word();
+
+        uint64_t* fields[] = {&times.user, &times.nice, &times.system, &times.idle,
+                              &times.iowait, &times.irq, &times.softirq, &times.steal};
+        for (auto* field : fields) {
+            if (!scanner.number(*field)) {
+                *field = 0;  // 오래된 커널은 뒤쪽 필드가 없음
+            }
+        }
+        scanner.nextLine();
+
+        if (label == "cpu") {
+            total = times;
+            has_total = true;
+            continue;
+        }
+
+        if (core_count == cores.size()) {
+            cores.resize(core_count + 1);
+        }
+        cores.busy[core_count] = times.user + times.nice + times.system + times.irq + times.softirq;
+        cores.idle[core_count] = times.idle;
+        cores.iowait[core_count] = times.iowait;
+        cores.steal[core_count] = times.steal;
+        ++core_count;
+    }
+
+    cores.resize(core_count);
+    return has_total;
+}
+
+CpuUsage CpuSampler::usageBetween(const CpuTimes& prev, const CpuTimes& cur) {
+    // 카운터는 단조 증가하지만, 일부 커널에서 iowait가 줄어드는 경우가 있어 되감기면 0 처리
+    double user = static_cast<double>(counterDelta(prev.user, cur.user) + counterDelta(prev.nice, cur.nice));
+    double system = static_cast<double>(counterDelta(prev.system, cur.system) + counterDelta(prev.irq, cur.irq)
+                                        + counterDelta(prev.softirq, cur.softirq));
+    double idle = static_cast<double>(counterDelta(prev.idle, cur.idle));
+    double iowait = static_cast<double>(counterDelta(prev.iowait, cur.iowait));
+    double steal = static_cast<double>(counterDelta(prev.steal, cur.steal));
+    double total = user + system + idle + iowait + steal;
+
+    CpuUsage usage;
+    if (total <= 0.0) return usage;
+
+    usage.user_pct = user / total * 100.0;
+    usage.system_pct = system / total * 100.0;
+    usage.iowait_pct = iowait / total * 100.0;
+    usage.steal_pct = steal / total * 100.0;
+    usage.total_pct = (total - idle - iowait) / total * 100.0;
+    return usage;
+}
+
+} // namespace sys
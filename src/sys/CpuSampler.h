@@ -0,0 +1,98 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ProcFile.h"
+
+namespace sys {
+
+// /proc/stat cpu 줄의 누적 jiffies
+struct CpuTimes {
+    uint64_t user{0};
+    uint64_t nice{0};
+    uint64_t system{0};
+    uint64_t idle{0};
+    uint64_t iowait{0};
+    uint64_t irq{0};
+    uint64_t softirq{0};
+    uint64_t steal{0};
+
+    uint64_t total() const { return user + nice + system + idle + iowait + irq + softirq + steal; }
+};
+
+// 두 샘플 사이 비율 (%)
+struct CpuUsage {
+    double total_pct{0};     // 100 - idle - iowait
+    double user_pct{0};      // user + nice
+    double system_pct{0};    // system + irq + softirq
+    double iowait_pct{0};
+    double steal_pct{0};
+};
+
+// 코어별 누적 카운터 (struct-of-arrays, 코어 인덱스 = 배열 인덱스)
+struct CoreCounters {
+    std::vector<uint64_t> busy;     // user + nice + system + irq + softirq
+    std::vector<uint64_t> idle;
+    std::vector<uint64_t> iowait;
+    std::vector<uint64_t> steal;
+
+    size_t size() const { return busy.size(); }
+    void resize(size_t count);
+};
+
+// 코어별 비율 (struct-of-arrays, %)
+struct CoreUsage {
+    std::vector<float> busy_pct;    // 100 - idle - iowait
+    std::vector<float> iowait_pct;
+    std::vector<float> steal_pct;
+
+    size_t size() const { return busy_pct.size(); }
+    void resize(size_t count);
+};
+
+// 코어 전체에 대한 차분 계산 - 분기 없는 연속 배열 루프 (컴파일러 자동 벡터화 대상)
+void computeCoreUsage(const CoreCounters& prev, const CoreCounters& cur, CoreUsage& out);
+
+// /proc/stat 기반 CPU 사용률 샘플러
+// 파일은 계속 열어두고 pread로 다시 읽으며, 직전 샘플과의 차이로 비율을 계산한다.
+class CpuSampler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit CpuSampler(std::string path = "/proc/stat",
+                        std::chrono::milliseconds min_interval = std::chrono::milliseconds(50));
+
+    // 새 샘플 수집 - min_interval 이내 재호출이면 직전 결과 유지
+    // 비율이 유효하면(두 번째 샘플부터) true
+    bool sample();
+
+    // 이미 읽은 /proc/stat 텍스트로 갱신 (테스트/벤치용)
+    bool update(std::string_view text);
+
+    const CpuUsage& getTotal() const { return total_; }
+    const CoreUsage& getCores() const { return cores_; }
+    size_t getCoreCount() const { return cores_.size(); }
+    bool isValid() const { return valid_; }
+
+private:
+    static bool parse(std::string_view text, CpuTimes& total, CoreCounters& cores);
+    static CpuUsage usageBetween(const CpuTimes& prev, const CpuTimes& cur);
+
+    ProcFile file_;
+    std::chrono::milliseconds min_interval_;
+    Clock::time_point last_sample_{};
+
+    CpuTimes prev_total_;
+    CpuTimes cur_total_;
+    CoreCounters prev_cores_;
+    CoreCounters cur_cores_;
+    bool primed_{false};
+    bool valid_{false};
+
+    CpuUsage total_;
+    CoreUsage cores_;
+};
+
+} // namespace sys
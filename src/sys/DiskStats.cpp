@@ -0,0 +1,171 @@
+#include "DiskStats.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace sys {
+
+namespace {
+constexpr double kSectorBytes = 512.0;
+constexpr double kMiB = 1024.0 * 1024.0;
+
+uint32_t narrow(uint64_t value) {
+    return static_cast<uint32_t>(std::min<uint64_t>(value, UINT32_MAX));
+}
+}
+
+DiskStatsMonitor::DiskStatsMonitor(std::string path) : file_(std::move(path)) {}
+
+bool DiskStatsMonitor::sample(Clock::time_point now) {
+    auto text = file_.read();
+    if (text.empty()) {
+        return false;
+    }
+    return update(text, now);
+}
+
+bool DiskStatsMonitor::update(std::string_view text, Clock::time_point now) {
+    double elapsed_ms = std::chrono::duration<double, std::milli>(now - last_time_).count();
+    uint32_t previous = generation_++;
+    bool any = false;
+
+    ProcScanner scanner(text);
+    while (!scanner.atEnd()) {
+        uint32_t major = 0;
+        uint32_t minor = 0;
+        std::string_view name;
+        DiskCounters counters;
+        if (parseLine(scanner, major, minor, name, counters) && !isVirtual(name)) {
+            if (DiskDevice* device = lookup(major, minor)) {
+                // 직전 샘플에 있던 장치만 차분 계산 (새로 붙었거나 다시 나타난 장치는 기준값)
+                bool continuous = device->primed && device->seen == previous && elapsed_ms > 0;
+                if (continuous) {
+                    computeUsage(device->counters, counters, elapsed_ms, device->usage);
+                    any = true;
+                } else {
+                    device->usage = DiskUsage{};
+                }
+                if (!device->primed || device->getName() != name) {
+                    size_t length = std::min(name.size(), device->name.size() - 1);
+                    std::memcpy(device->name.data(), name.data(), length);
+                    device->name[length] = '\0';
+                }
+                device->counters = counters;
+                device->seen = generation_;
+                device->primed = true;
+            }
+        }
+        scanner.nextLine();
+    }
+
+    last_time_ = now;
+    return any;
+}
+
+bool DiskStatsMonitor::parseLine(ProcScanner& scanner, uint32_t& major, uint32_t& minor,
+                                 std::string_view& name, DiskCounters& counters) {
+    // major minor name reads reads_merged sectors_read ms_reading
+    //                  writes writes_merged sectors_written ms_writing in_flight ms_io weighted_ms [discard/flush...]
+    uint64_t major_value = 0;
+    uint64_t minor_value = 0;
+    uint64_t merged = 0;
+    if (!scanner.number(major_value) || !scanner.number(minor_value)) {
+        return false;
+    }
+    name = scanner.word();
+    if (name.empty()) {
+        return false;
+    }
+    major = narrow(major_value);
+    minor = narrow(minor_value);
+
+    return scanner.number(counters.reads) && scanner.number(merged)
+        && scanner.number(counters.read_sectors) && scanner.number(counters.read_ms)
+        && scanner.number(counters.writes) && scanner.number(merged)
+        && scanner.number(counters.write_sectors) && scanner.number(counters.write_ms)
+        && scanner.number(counters.in_flight) && scanner.number(counters.io_ms)
+        && scanner.number(counters.weighted_ms);
+}
+
+bool DiskStatsMonitor::isVirtual(std::string_view name) {
+    return name.starts_with("loop") || name.starts_with("ram") || name.starts_with("zram");
+}
+
+size_t DiskStatsMonitor::slotOf(uint32_t major, uint32_t minor) {
+    // 곱셈 해시 상위 비트 (kMaxDevices = 2^7)
+    uint64_t key = (static_cast<uint64_t>(major) << 32) | minor;
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 57) & (kMaxDevices - 1);
+}
+
+DiskDevice* DiskStatsMonitor::lookup(uint32_t major, uint32_t minor) {
+    size_t slot = slotOf(major, minor);
+    for (size_t probe = 0; probe < kMaxDevices; ++probe) {
+        auto& device = table_[(slot + probe) & (kMaxDevices - 1)];
+        if (!device.used) {
+            device.used = true;
+            device.major = major;
+            device.minor = minor;
+            return &device;
+        }
+        if (device.major == major && device.minor == minor) {
+            return &device;
+        }
+    }
+
+    if (!table_full_warned_) {
+        std::cerr << "diskstats 장치 테이블 가득 참: " << major << ":" << minor << " 무시" << std::endl;
+        table_full_warned_ = true;
+    }
+    return nullptr;
+}
+
+const DiskDevice* DiskStatsMonitor::find(uint32_t major, uint32_t minor) const {
+    size_t slot = slotOf(major, minor);
+    for (size_t probe = 0; probe < kMaxDevices; ++probe) {
+        const auto& device = table_[(slot + probe) & (kMaxDevices - 1)];
+        if (!device.used) break;
+        if (device.major == major && device.minor == minor) {
+            return isActive(device) ? &device : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+const DiskDevice* DiskStatsMonitor::find(std::string_view name) const {
+    for (const auto& device : table_) {
+        if (isActive(device) && device.getName() == name) return &device;
+    }
+    return nullptr;
+}
+
+const DiskDevice* DiskStatsMonitor::busiest(std::string_view name) const {
+    if (!name.empty()) {
+        return find(name);
+    }
+    const DiskDevice* best = nullptr;
+    for (const auto& device : table_) {
+        if (isActive(device) && (!best || device.usage.util_pct > best->usage.util_pct)) {
+            best = &device;
+        }
+    }
+    return best;
+}
+
+void DiskStatsMonitor::computeUsage(const DiskCounters& prev, const DiskCounters& cur, double elapsed_ms, DiskUsage& out) {
+    double seconds = elapsed_ms / 1000.0;
+    uint64_t reads = counterDelta(prev.reads, cur.reads);
+    uint64_t writes = counterDelta(prev.writes, cur.writes);
+    uint64_t ios = reads + writes;
+
+    out.read_mbps = counterDelta(prev.read_sectors, cur.read_sectors) * kSectorBytes / kMiB / seconds;
+    out.write_mbps = counterDelta(prev.write_sectors, cur.write_sectors) * kSectorBytes / kMiB / seconds;
+    out.read_iops = reads / seconds;
+    out.write_iops = writes / seconds;
+    out.queue_depth = counterDelta(prev.weighted_ms, cur.weighted_ms) / elapsed_ms;
+    out.await_ms = ios > 0
+        ? static_cast<double>(counterDelta(prev.read_ms, cur.read_ms) + counterDelta(prev.write_ms, cur.write_ms)) / ios
+        : 0.0;
+    out.util_pct = std::min(100.0, counterDelta(prev.io_ms, cur.io_ms) / elapsed_ms * 100.0);
+}
+
+} // namespace sys
@@ -0,0 +1,104 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "ProcFile.h"
+
+namespace sys {
+
+// /proc/diskstats 한 줄의 누적 카운터 (섹터는 항상 512바이트 단위)
+struct DiskCounters {
+    uint64_t reads{0};
+    uint64_t read_sectors{0};
+    uint64_t read_ms{0};
+    uint64_t writes{0};
+    uint64_t write_sectors{0};
+    uint64_t write_ms{0};
+    uint64_t in_flight{0};        // 누적값이 아닌 현재값
+    uint64_t io_ms{0};            // 장치가 바빴던 시간
+    uint64_t weighted_ms{0};      // 요청 대기+처리 시간 합 (큐 깊이 계산용)
+};
+
+// 두 샘플 사이 장치 처리량/지연
+struct DiskUsage {
+    double read_mbps{0};
+    double write_mbps{0};
+    double read_iops{0};
+    double write_iops{0};
+    double queue_depth{0};        // 평균 대기 요청 수 (iostat aqu-sz)
+    double await_ms{0};           // 요청당 평균 완료 시간 (iostat await)
+    double util_pct{0};           // 장치가 바빴던 시간 비율
+};
+
+// 장치 항목 - major:minor로 찾는다
+struct DiskDevice {
+    uint32_t major{0};
+    uint32_t minor{0};
+    std::array<char, 32> name{};  // NUL 종료, 줄마다 문자열 할당하지 않도록 고정 버퍼
+    DiskCounters counters;
+    DiskUsage usage;
+    uint32_t seen{0};             // 마지막으로 보인 샘플 번호
+    bool used{false};
+    bool primed{false};
+
+    std::string_view getName() const { return name.data(); }
+};
+
+// /proc/diskstats 기반 블록 장치 처리량/지연 수집기
+// 파일은 ProcFile로 열어두고, 한 번의 순회로 major:minor 키의 고정 크기 테이블을 갱신한다.
+// 샘플 중에는 힙 할당이 없다.
+class DiskStatsMonitor {
+public:
+    using Clock = std::chrono::steady_clock;
+    static constexpr size_t kMaxDevices = 128;    // 2의 거듭제곱 (열린 주소법 테이블)
+
+    explicit DiskStatsMonitor(std::string path = "/proc/diskstats");
+
+    // 새 샘플, 비율이 유효한 장치가 있으면 true
+    bool sample() { return sample(Clock::now()); }
+    bool sample(Clock::time_point now);
+
+    // 이미 읽은 텍스트로 갱신 (테스트용)
+    bool update(std::string_view text, Clock::time_point now);
+
+    // 장치 조회 (없거나 사라졌으면 nullptr)
+    const DiskDevice* find(uint32_t major, uint32_t minor) const;
+    const DiskDevice* find(std::string_view name) const;
+
+    // 이번 샘플에 보인 장치 중 util_pct가 가장 높은 장치 (없으면 nullptr)
+    // name이 비어있지 않으면 그 장치를 고정
+    const DiskDevice* busiest(std::string_view name = {}) const;
+
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        for (const auto& device : table_) {
+            if (isActive(device)) fn(device);
+        }
+    }
+
+    // 한 줄 파싱 (테스트용 공개), 형식이 맞지 않으면 false
+    static bool parseLine(ProcScanner& scanner, uint32_t& major, uint32_t& minor,
+                          std::string_view& name, DiskCounters& counters);
+
+    // 사용하지 않는 가상 장치 (loop, ram, zram 등)
+    static bool isVirtual(std::string_view name);
+
+private:
+    DiskStatsMonitor(const DiskStatsMonitor&) = delete;
+    DiskStatsMonitor& operator=(const DiskStatsMonitor&) = delete;
+
+    static size_t slotOf(uint32_t major, uint32_t minor);
+    DiskDevice* lookup(uint32_t major, uint32_t minor);
+    bool isActive(const DiskDevice& device) const { return device.used && device.seen == generation_; }
+    static void computeUsage(const DiskCounters& prev, const DiskCounters& cur, double elapsed_ms, DiskUsage& out);
+
+    ProcFile file_;
+    std::array<DiskDevice, kMaxDevices> table_{};
+    uint32_t generation_{0};
+    Clock::time_point last_time_{};
+    bool table_full_warned_{false};
+};
+
+} // namespace sys
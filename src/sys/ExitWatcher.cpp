@@ -0,0 +1,145 @@
+#include "ExitWatcher.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+#ifndef _WIN32
+#include <sys/epoll.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace sys {
+
+namespace {
+constexpr int kMaxEvents = 16;
+
+#ifndef _WIN32
+int pidfdOpen(int pid) {
+#ifdef SYS_pidfd_open
+    return static_cast<int>(::syscall(SYS_pidfd_open, pid, 0));
+#else
+    (void)pid;
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+#endif
+}
+
+ExitWatcher::ExitWatcher() {
+#ifdef _WIN32
+    pidfd_supported_ = false;
+#else
+    epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd_ < 0) {
+        std::cerr << "epoll 생성 실패: " << std::strerror(errno) << std::endl;
+    }
+#endif
+}
+
+ExitWatcher::~ExitWatcher() {
+#ifndef _WIN32
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& watch : watches_) {
+        ::close(watch.fd);
+    }
+    watches_.clear();
+    if (epoll_fd_ >= 0) {
+        ::close(epoll_fd_);
+    }
+#endif
+}
+
+bool ExitWatcher::watch(int pid) {
+#ifdef _WIN32
+    (void)pid;
+    return false;
+#else
+    if (epoll_fd_ < 0 || !pidfd_supported_ || pid <= 0) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (std::any_of(watches_.begin(), watches_.end(), [pid](const Watch& w) { return w.pid == pid; })) {
+        return true;
+    }
+
+    int fd = pidfdOpen(pid);
+    if (fd < 0) {
+        if (errno == ENOSYS) {
+            pidfd_supported_ = false;  // 오래된 커널 - 주기적 /proc 확인에 맡긴다
+            std::cerr << "pidfd_open 미지원 - 프로세스 종료는 /proc 확인으로만 감지" << std::endl;
+        }
+        return false;
+    }
+
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = static_cast<uint32_t>(pid);
+    if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) < 0) {
+        std::cerr << "pidfd epoll 등록 실패: " << pid << ": " << std::strerror(errno) << std::endl;
+        ::close(fd);
+        return false;
+    }
+    watches_.push_back({pid, fd});
+    return true;
+#endif
+}
+
+void ExitWatcher::unwatch(int pid) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < watches_.size(); ++i) {
+        if (watches_[i].pid == pid) {
+            removeLocked(i);
+            return;
+        }
+    }
+}
+
+size_t ExitWatcher::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return watches_.size();
+}
+
+void ExitWatcher::removeLocked(size_t index) {
+#ifndef _WIN32
+    ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, watches_[index].fd, nullptr);
+    ::close(watches_[index].fd);
+#endif
+    watches_.erase(watches_.begin() + static_cast<std::ptrdiff_t>(index));
+}
+
+std::vector<int> ExitWatcher::wait(std::chrono::milliseconds timeout) {
+    std::vector<int> exited;
+#ifdef _WIN32
+    (void)timeout;
+#else
+    if (epoll_fd_ < 0) {
+        return exited;
+    }
+
+    epoll_event events[kMaxEvents];
+    int ready = ::epoll_wait(epoll_fd_, events, kMaxEvents, static_cast<int>(timeout.count()));
+    if (ready <= 0) {
+        return exited;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int i = 0; i < ready; ++i) {
+        int pid = static_cast<int>(events[i].data.u64);
+        for (size_t j = 0; j < watches_.size(); ++j) {
+            // 대기 중 unwatch된 pid는 건너뛴다
+            if (watches_[j].pid == pid) {
+                removeLocked(j);
+                exited.push_back(pid);
+                break;
+            }
+        }
+    }
+#endif
+    return exited;
+}
+
+} // namespace sys
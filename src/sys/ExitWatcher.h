@@ -0,0 +1,44 @@
+#pragma once
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+namespace sys {
+
+// pidfd + epoll 기반 프로세스 종료 감시
+// 감시 중인 프로세스가 끝나면 pidfd가 읽기 가능해지므로, /proc을 다시 훑지 않고도
+// 수 ms 안에 종료를 알 수 있다. watch/unwatch와 wait는 서로 다른 스레드에서 불러도 된다.
+class ExitWatcher {
+public:
+    ExitWatcher();
+    ~ExitWatcher();
+
+    // epoll 생성 성공 여부 (pidfd_open 지원은 첫 watch()에서 확인)
+    bool isSupported() const { return epoll_fd_ >= 0 && pidfd_supported_; }
+
+    // pid 감시 시작, pidfd_open 실패(커널 < 5.3, 이미 종료 등)면 false
+    bool watch(int pid);
+    void unwatch(int pid);
+    size_t size() const;
+
+    // 종료된 pid 목록 (타임아웃이면 빈 목록), 보고한 pid는 감시에서 빠진다
+    std::vector<int> wait(std::chrono::milliseconds timeout);
+
+private:
+    ExitWatcher(const ExitWatcher&) = delete;
+    ExitWatcher& operator=(const ExitWatcher&) = delete;
+
+    struct Watch {
+        int pid;
+        int fd;
+    };
+
+    void removeLocked(size_t index);
+
+    int epoll_fd_{-1};
+    bool pidfd_supported_{true};
+    mutable std::mutex mutex_;
+    std::vector<Watch> watches_;
+};
+
+} // namespace sys
@@ -0,0 +1,160 @@
+#include "InterruptSampler.h"
+#include <algorithm>
+
+namespace sys {
+
+namespace {
+// 코어 수만큼 이어지는 숫자 열을 읽어 values에 기록
+void readPerCpu(ProcScanner& scanner, std::vector<uint64_t>& values) {
+    for (auto& value : values) {
+        if (!scanner.number(value)) {
+            value = 0;
+        }
+    }
+}
+}
+
+void SoftirqCounters::resize(size_t count) {
+    net_rx.resize(count);
+    net_tx.resize(count);
+}
+
+void SoftirqUsage::resize(size_t count) {
+    net_rx_per_s.resize(count);
+    net_tx_per_s.resize(count);
+    net_rx_share_pct.resize(count);
+}
+
+InterruptSampler::InterruptSampler(std::string stat_path, std::string softirqs_path)
+    : stat_file_(std::move(stat_path))
+    , softirqs_file_(std::move(softirqs_path)) {}
+
+bool InterruptSampler::sample(Clock::time_point now) {
+    auto stat_text = stat_file_.read();
+    if (stat_text.empty()) {
+        return false;
+    }
+    // 두 파일은 버퍼가 따로라 view가 함께 유효하다
+    return update(stat_text, softirqs_file_.read(), now);
+}
+
+bool InterruptSampler::update(std::string_view stat_text, std::string_view softirqs_text, Clock::time_point now) {
+    InterruptCounters counters;
+    if (!parseStat(stat_text, counters)) {
+        return false;
+    }
+    if (softirqs_text.empty() || !parseSoftirqs(softirqs_text, cur_cores_)) {
+        cur_cores_.resize(0);
+    }
+
+    double seconds = std::chrono::duration<double>(now - last_time_).count();
+    if (primed_ && seconds > 0) {
+        rates_.ctxt_per_s = counterDelta(prev_.ctxt, counters.ctxt) / seconds;
+        rates_.intr_per_s = counterDelta(prev_.intr, counters.intr) / seconds;
+        rates_.softirq_per_s = counterDelta(prev_.softirq, counters.softirq) / seconds;
+        rates_.forks_per_s = counterDelta(prev_.processes, counters.processes) / seconds;
+
+        // 코어 수가 바뀌면(핫플러그) 코어별 값은 다음 샘플부터
+        if (cur_cores_.size() == prev_cores_.size()) {
+            computeCores(seconds);
+        } else {
+            cores_.resize(0);
+            rates_.net_rx_per_s = rates_.net_tx_per_s = rates_.net_rx_max_core_per_s = 0;
+            rates_.net_rx_max_core = 0;
+        }
+        valid_ = true;
+    }
+
+    prev_ = counters;
+    std::swap(prev_cores_, cur_cores_);
+    last_time_ = now;
+    primed_ = true;
+    return valid_;
+}
+
+void InterruptSampler::computeCores(double seconds) {
+    const size_t count = cur_cores_.size();
+    cores_.resize(count);
+
+    const uint64_t* __restrict rx0 = prev_cores_.net_rx.data();
+    const uint64_t* __restrict tx0 = prev_cores_.net_tx.data();
+    const uint64_t* __restrict rx1 = cur_cores_.net_rx.data();
+    const uint64_t* __restrict tx1 = cur_cores_.net_tx.data();
+    float* __restrict rx_rate = cores_.net_rx_per_s.data();
+    float* __restrict tx_rate = cores_.net_tx_per_s.data();
+    float* __restrict rx_share = cores_.net_rx_share_pct.data();
+
+    const float per_second = static_cast<float>(1.0 / seconds);
+    double rx_total = 0;
+    double tx_total = 0;
+    size_t max_core = 0;
+    for (size_t i = 0; i < count; ++i) {
+        rx_rate[i] = static_cast<float>(counterDelta(rx0[i], rx1[i])) * per_second;
+        tx_rate[i] = static_cast<float>(counterDelta(tx0[i], tx1[i])) * per_second;
+        rx_total += rx_rate[i];
+        tx_total += tx_rate[i];
+        if (rx_rate[i] > rx_rate[max_core]) max_core = i;
+    }
+
+    const float share_scale = static_cast<float>(100.0 / std::max(rx_total, 1.0));
+    for (size_t i = 0; i < count; ++i) {
+        rx_share[i] = rx_rate[i] * share_scale;
+    }
+
+    rates_.net_rx_per_s = rx_total;
+    rates_.net_tx_per_s = tx_total;
+    rates_.net_rx_max_core = max_core;
+    rates_.net_rx_max_core_per_s = count > 0 ? rx_rate[max_core] : 0.0;
+}
+
+bool InterruptSampler::parseStat(std::string_view text, InterruptCounters& counters) {
+    ProcScanner scanner(text);
+    bool has_ctxt = false;
+
+    while (!scanner.atEnd()) {
+        // cpu 줄은 CpuSampler 몫, intr/softirq 줄은 첫 숫자(합계)만 필요
+        if (!scanner.startsWith("cpu")) {
+            auto key = scanner.word();
+            if (key == "ctxt") {
+                has_ctxt = scanner.number(counters.ctxt);
+            } else if (key == "intr") {
+                scanner.number(counters.intr);
+            } else if (key == "softirq") {
+                scanner.number(counters.softirq);
+            } else if (key == "processes") {
+                scanner.number(counters.processes);
+            }
+        }
+        scanner.nextLine();
+    }
+    return has_ctxt;
+}
+
+bool InterruptSampler::parseSoftirqs(std::string_view text, SoftirqCounters& counters) {
+    // 첫 줄 "CPU0 CPU1 ..." 의 열 수가 코어 수
+    ProcScanner scanner(text);
+    size_t count = 0;
+    while (scanner.word().starts_with("CPU")) {
+        ++count;
+    }
+    if (count == 0) {
+        return false;
+    }
+    scanner.nextLine();
+    counters.resize(count);
+
+    bool has_rx = false;
+    while (!scanner.atEnd()) {
+        auto label = scanner.word();
+        if (label == "NET_RX:") {
+            readPerCpu(scanner, counters.net_rx);
+            has_rx = true;
+        } else if (label == "NET_TX:") {
+            readPerCpu(scanner, counters.net_tx);
+        }
+        scanner.nextLine();
+    }
+    return has_rx;
+}
+
+} // namespace sys
@@ -0,0 +1,96 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ProcFile.h"
+
+namespace sys {
+
+// /proc/stat의 시스템 전체 누적 카운터
+struct InterruptCounters {
+    uint64_t ctxt{0};         // 컨텍스트 스위치
+    uint64_t intr{0};         // 하드웨어 인터럽트 합계
+    uint64_t softirq{0};      // softirq 합계
+    uint64_t processes{0};    // fork 수
+};
+
+// /proc/softirqs의 코어별 네트워크 softirq 누적 카운터 (struct-of-arrays)
+struct SoftirqCounters {
+    std::vector<uint64_t> net_rx;
+    std::vector<uint64_t> net_tx;
+
+    size_t size() const { return net_rx.size(); }
+    void resize(size_t count);
+};
+
+// 두 샘플 사이 초당 발생 수
+struct InterruptRates {
+    double ctxt_per_s{0};
+    double intr_per_s{0};
+    double softirq_per_s{0};
+    double forks_per_s{0};
+    double net_rx_per_s{0};              // 전체 코어 NET_RX 합
+    double net_tx_per_s{0};
+    double net_rx_max_core_per_s{0};     // NET_RX가 가장 많은 코어의 초당 수
+    size_t net_rx_max_core{0};           // 그 코어 번호
+};
+
+// 코어별 비율 (struct-of-arrays)
+struct SoftirqUsage {
+    std::vector<float> net_rx_per_s;
+    std::vector<float> net_tx_per_s;
+    std::vector<float> net_rx_share_pct; // 전체 NET_RX 중 코어 비중 (%)
+
+    size_t size() const { return net_rx_per_s.size(); }
+    void resize(size_t count);
+};
+
+// 컨텍스트 스위치 / 인터럽트 / softirq 발생률 샘플러
+// CpuSampler와 같이 /proc/stat, /proc/softirqs를 열어두고 pread로 다시 읽으며,
+// 코어 수가 바뀌지 않는 한 샘플 중 힙 할당이 없다.
+class InterruptSampler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit InterruptSampler(std::string stat_path = "/proc/stat",
+                              std::string softirqs_path = "/proc/softirqs");
+
+    // 새 샘플, 비율이 유효하면(두 번째 샘플부터) true
+    bool sample() { return sample(Clock::now()); }
+    bool sample(Clock::time_point now);
+
+    // 이미 읽은 텍스트로 갱신 (테스트용), softirqs가 비어있으면 코어별 값 없이 계산
+    bool update(std::string_view stat_text, std::string_view softirqs_text, Clock::time_point now);
+
+    const InterruptRates& getRates() const { return rates_; }
+    const SoftirqUsage& getCores() const { return cores_; }
+    size_t getCoreCount() const { return cores_.size(); }
+    bool isValid() const { return valid_; }
+
+    // 파일 내용 파싱 (테스트용 공개)
+    static bool parseStat(std::string_view text, InterruptCounters& counters);
+    static bool parseSoftirqs(std::string_view text, SoftirqCounters& counters);
+
+private:
+    InterruptSampler(const InterruptSampler&) = delete;
+    InterruptSampler& operator=(const InterruptSampler&) = delete;
+
+    void computeCores(double seconds);
+
+    ProcFile stat_file_;
+    ProcFile softirqs_file_;
+
+    InterruptCounters prev_;
+    SoftirqCounters prev_cores_;
+    SoftirqCounters cur_cores_;
+    Clock::time_point last_time_{};
+    bool primed_{false};
+    bool valid_{false};
+
+    InterruptRates rates_;
+    SoftirqUsage cores_;
+};
+
+} // namespace sys
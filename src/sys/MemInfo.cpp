@@ -0,0 +1,41 @@
+#include "MemInfo.h"
+
+namespace sys {
+
+MemInfoReader::MemInfoReader(std::string path) : file_(std::move(path)) {}
+
+bool MemInfoReader::read(MemInfo& info) {
+    return parse(file_.read(), info);
+}
+
+bool MemInfoReader::parse(std::string_view text, MemInfo& info) {
+    // "MemTotal:       16318480 kB" - 키 단어 비교 후 숫자만 읽는다 (복사/sscanf 없음)
+    constexpr int kWanted = 5;
+    ProcScanner scanner(text);
+    int found = 0;
+    bool has_total = false;
+    bool has_available = false;
+    info = MemInfo{};
+    while (!scanner.atEnd() && found < kWanted) {
+        auto key = scanner.word();
+        uint64_t* field = nullptr;
+        if (key == "MemTotal:") field = &info.total_kb;
+        else if (key == "MemFree:") field = &info.free_kb;
+        else if (key == "MemAvailable:") field = &info.available_kb;
+        else if (key == "Buffers:") field = &info.buffers_kb;
+        else if (key == "Cached:") field = &info.cached_kb;
+        if (field && scanner.number(*field)) {
+            ++found;
+            has_total = has_total || field == &info.total_kb;
+            has_available = has_available || field == &info.available_kb;
+        }
+        scanner.nextLine();
+    }
+    if (!has_available) {
+        // MemAvailable이 없는 오래된 커널 (< 3.14) - 근사값
+        info.available_kb = info.free_kb + info.buffers_kb + info.cached_kb;
+    }
+    return has_total && info.total_kb > 0;
+}
+
+} // namespace sys
@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "ProcFile.h"
+
+namespace sys {
+
+// /proc/meminfo에서 쓰는 값 (kB)
+struct MemInfo {
+    uint64_t total_kb{0};
+    uint64_t free_kb{0};
+    uint64_t available_kb{0};
+    uint64_t buffers_kb{0};
+    uint64_t cached_kb{0};
+
+    uint64_t usedKb() const { return total_kb > available_kb ? total_kb - available_kb : 0; }
+};
+
+// /proc/meminfo 리더 - 파일은 열어둔 채 pread로 다시 읽고, 버퍼 위에서 바로 파싱한다
+// 필요한 키는 모두 파일 앞쪽에 있어 다 찾으면 나머지 줄은 보지 않는다.
+class MemInfoReader {
+public:
+    explicit MemInfoReader(std::string path = "/proc/meminfo");
+
+    bool read(MemInfo& info);
+
+    // meminfo 텍스트 파싱 (테스트용 공개), MemTotal이 없으면 false
+    static bool parse(std::string_view text, MemInfo& info);
+
+private:
+    ProcFile file_;
+};
+
+} // namespace sys
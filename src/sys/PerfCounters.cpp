@@ -0,0 +1,176 @@
+#include "PerfCounters.h"
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace sys {
+
+namespace {
+#ifndef _WIN32
+// 그룹 순서 = read() 결과 순서 (리더가 첫 번째)
+constexpr uint64_t kConfigs[] = {
+    PERF_COUNT_SW_TASK_CLOCK,
+    PERF_COUNT_SW_CONTEXT_SWITCHES,
+    PERF_COUNT_SW_CPU_MIGRATIONS,
+    PERF_COUNT_SW_PAGE_FAULTS,
+};
+
+int openEvent(uint64_t config, int pid, int group_fd, bool exclude_kernel) {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_SOFTWARE;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.inherit = 1;
+    attr.exclude_kernel = exclude_kernel ? 1 : 0;
+    attr.exclude_hv = 1;
+    return static_cast<int>(::syscall(SYS_perf_event_open, &attr, pid, -1, group_fd, PERF_FLAG_FD_CLOEXEC));
+}
+
+// /proc/<pid>/task 의 TID 목록 (프로세스가 없으면 빈 목록)
+std::vector<int> listThreads(int pid) {
+    std::vector<int> tids;
+    char path[64];
+    std::snprintf(path, sizeof(path), "/proc/%d/task", pid);
+    DIR* dir = opendir(path);
+    if (!dir) {
+        return tids;
+    }
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != nullptr) {
+        int tid = 0;
+        auto end = entry->d_name + std::strlen(entry->d_name);
+        auto result = std::from_chars(entry->d_name, end, tid);
+        if (result.ec == std::errc() && result.ptr == end && tid > 0) {
+            tids.push_back(tid);
+        }
+    }
+    closedir(dir);
+    return tids;
+}
+#endif
+
+// 권한 문제는 프로세스마다 반복되므로 한 번만 알린다
+std::atomic<bool> g_reported{false};
+}
+
+PerfGroup::PerfGroup(int pid) {
+#ifdef _WIN32
+    (void)pid;
+#else
+    static_assert(sizeof(kConfigs) / sizeof(kConfigs[0]) == kEvents);
+    // 이미 떠 있는 스레드는 inherit로 잡히지 않으므로 TID마다 그룹을 연다
+    auto tids = listThreads(pid);
+    threads_.reserve(tids.size());
+    int error = 0;
+    bool exclude_kernel = false;
+    for (int tid : tids) {
+        ThreadGroup group;
+        int result = openThread(tid, exclude_kernel, group);
+        // perf_event_paranoid >= 2 에서는 커널 구간 계수가 막힐 수 있어 사용자 구간만으로 재시도
+        // (합계 기준이 섞이지 않게 첫 스레드에서 정한 모드를 모든 스레드에 쓴다)
+        if ((result == EACCES || result == EPERM) && !exclude_kernel && threads_.empty()) {
+            exclude_kernel = true;
+            result = openThread(tid, exclude_kernel, group);
+        }
+        if (result == 0) {
+            threads_.push_back(group);
+        } else if (result != ESRCH) {
+            // 일부 스레드만 세면 합계가 작게 나오므로 전부 닫는다 (열거 중 끝난 스레드는 건너뜀)
+            error = result;
+            close();
+            break;
+        }
+    }
+    // 대상이 이미 종료(ESRCH/task 디렉터리 없음)된 경우는 조용히 넘어간다
+    if (error != 0 && !g_reported.exchange(true)) {
+        std::cerr << "perf_event_open 실패: " << pid << ": " << std::strerror(error)
+                  << " (kernel.perf_event_paranoid 확인)" << std::endl;
+    }
+#endif
+}
+
+PerfGroup::~PerfGroup() {
+    close();
+}
+
+int PerfGroup::openThread(int tid, bool exclude_kernel, ThreadGroup& group) {
+#ifdef _WIN32
+    (void)tid;
+    (void)exclude_kernel;
+    (void)group;
+    return ENOSYS;
+#else
+    for (int i = 0; i < kEvents; ++i) {
+        group.fds[i] = openEvent(kConfigs[i], tid, i == 0 ? -1 : group.fds[0], exclude_kernel);
+        if (group.fds[i] < 0) {
+            int error = errno;
+            for (int& fd : group.fds) {
+                if (fd >= 0) ::close(fd);
+                fd = -1;
+            }
+            return error;
+        }
+    }
+    return 0;
+#endif
+}
+
+void PerfGroup::close() {
+#ifndef _WIN32
+    for (auto& group : threads_) {
+        for (int& fd : group.fds) {
+            if (fd >= 0) ::close(fd);
+            fd = -1;
+        }
+    }
+#endif
+    threads_.clear();
+}
+
+bool PerfGroup::read(PerfSample& sample) {
+#ifdef _WIN32
+    (void)sample;
+    return false;
+#else
+    bool any = false;
+    PerfSample total;
+    for (auto& group : threads_) {
+        // { nr, time_enabled, time_running, value[nr] }
+        uint64_t buffer[3 + kEvents];
+        ssize_t n = ::read(group.fds[0], buffer, sizeof(buffer));
+        if (n == static_cast<ssize_t>(sizeof(buffer)) && buffer[0] == kEvents) {
+            group.last.time_enabled = buffer[1];
+            group.last.time_running = buffer[2];
+            group.last.task_clock_ns = buffer[3];
+            group.last.context_switches = buffer[4];
+            group.last.cpu_migrations = buffer[5];
+            group.last.page_faults = buffer[6];
+            any = true;
+        }
+        total.time_enabled += group.last.time_enabled;
+        total.time_running += group.last.time_running;
+        total.task_clock_ns += group.last.task_clock_ns;
+        total.context_switches += group.last.context_switches;
+        total.cpu_migrations += group.last.cpu_migrations;
+        total.page_faults += group.last.page_faults;
+    }
+    if (!any) {
+        return false;
+    }
+    sample = total;
+    return true;
+#endif
+}
+
+} // namespace sys
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+namespace sys {
+
+// 소프트웨어 perf 카운터 누적값 (PMU가 필요 없어 VM에서도 동작)
+struct PerfSample {
+    uint64_t task_clock_ns{0};      // 실제로 CPU에서 돈 시간
+    uint64_t context_switches{0};
+    uint64_t cpu_migrations{0};
+    uint64_t page_faults{0};
+    uint64_t time_enabled{0};
+    uint64_t time_running{0};
+};
+
+// 프로세스 하나의 perf_event_open 그룹 (task-clock 리더 + 문맥 전환/이주/페이지 폴트)
+// inherit는 연 뒤에 생기는 자식 스레드만 세므로, 열 때 /proc/<pid>/task의 스레드마다
+// 그룹을 하나씩 열고(PERF_FORMAT_GROUP으로 read() 한 번에 네 값) 합산한다.
+// 이후 생기는 스레드(방송 시작 시 인코더/출력 스레드 등)는 부모 스레드 그룹의 inherit로 잡힌다.
+class PerfGroup {
+public:
+    explicit PerfGroup(int pid);
+    ~PerfGroup();
+
+    bool isOpen() const { return !threads_.empty(); }
+    // 스레드 그룹 합계. 모든 그룹 읽기가 실패(프로세스 종료 등)면 false
+    bool read(PerfSample& sample);
+
+private:
+    PerfGroup(const PerfGroup&) = delete;
+    PerfGroup& operator=(const PerfGroup&) = delete;
+
+    static constexpr int kEvents = 4;
+
+    // 스레드 하나의 그룹. 끝난 스레드의 카운터도 fd로 계속 읽히지만,
+    // 읽기가 실패하면 마지막 값을 합계에 유지해 누적값이 뒤로 가지 않게 한다.
+    struct ThreadGroup {
+        int fds[kEvents]{-1, -1, -1, -1};
+        PerfSample last;
+    };
+
+    // 실패 시 errno 반환, 성공 시 0
+    int openThread(int tid, bool exclude_kernel, ThreadGroup& group);
+    void close();
+
+    std::vector<ThreadGroup> threads_;
+};
+
+} // namespace sys
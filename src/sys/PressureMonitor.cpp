@@ -0,0 +1,170 @@
+#include "PressureMonitor.h"
+#include "CgroupMonitor.h"
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+namespace sys {
+
+namespace {
+bool fileExists(const std::string& path) {
+    std::error_code ec;
+    return std::filesystem::exists(path, ec);
+}
+
+bool parseLine(ProcScanner& scanner, PressureLine& line) {
+    return scanner.expect("avg10=") && scanner.decimal(line.avg10)
+        && scanner.expect("avg60=") && scanner.decimal(line.avg60)
+        && scanner.expect("avg300=") && scanner.decimal(line.avg300)
+        && scanner.expect("total=") && scanner.number(line.total_us);
+}
+}
+
+const char* pressureResourceName(PressureResource resource) {
+    switch (resource) {
+        case PressureResource::Cpu: return "cpu";
+        case PressureResource::Memory: return "memory";
+        case PressureResource::Io: return "io";
+        default: return "unknown";
+    }
+}
+
+PressureMonitor::PressureMonitor(std::string proc_dir, std::string cgroup_dir) {
+    for (size_t i = 0; i < kPressureResourceCount; ++i) {
+        std::string name = pressureResourceName(static_cast<PressureResource>(i));
+        std::string path = proc_dir + "/" + name;
+        if (!cgroup_dir.empty() && fileExists(cgroup_dir + "/" + name + ".pressure")) {
+            path = cgroup_dir + "/" + name + ".pressure";
+        }
+        resources_[i].file = std::make_unique<ProcFile>(path);
+    }
+}
+
+bool PressureMonitor::sample() {
+    bool any = false;
+    for (auto& resource : resources_) {
+        PressureStat stat;
+        auto text = resource.file->read();
+        if (text.empty() || !parse(text, stat)) {
+            resource.available = false;
+            continue;
+        }
+
+        resource.usage.some_avg10 = stat.some.avg10;
+        resource.usage.full_avg10 = stat.full.avg10;
+        if (resource.primed) {
+            resource.usage.some_stall_us = counterDelta(resource.last.some.total_us, stat.some.total_us);
+            resource.usage.full_stall_us = counterDelta(resource.last.full.total_us, stat.full.total_us);
+        }
+        resource.last = stat;
+        resource.primed = true;
+        resource.available = true;
+        any = true;
+    }
+    return any;
+}
+
+bool PressureMonitor::parse(std::string_view text, PressureStat& stat) {
+    ProcScanner scanner(text);
+    bool has_some = false;
+
+    while (!scanner.atEnd()) {
+        auto kind = scanner.word();
+        if (kind == "some") {
+            has_some = parseLine(scanner, stat.some);
+            if (!has_some) return false;
+        } else if (kind == "full") {
+            if (!parseLine(scanner, stat.full)) return false;
+        }
+        scanner.nextLine();
+    }
+    return has_some;
+}
+
+std::string PressureMonitor::detectCgroupDir(const std::string& cgroup_root) {
+    auto dir = findCgroupDir(cgroup_root);
+    return !dir.empty() && fileExists(dir + "/cpu.pressure") ? dir : std::string();
+}
+
+PressureTriggers::~PressureTriggers() {
+    close();
+}
+
+bool PressureTriggers::add(const std::string& path, PressureResource resource, PressureKind kind,
+                           std::chrono::microseconds stall, std::chrono::microseconds window) {
+#ifdef _WIN32
+    return false;  // PSI 없음
+#else
+    int fd = ::open(path.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        std::cerr << "PSI 트리거 열기 실패: " << path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    // 종료 문자까지 포함해 기록해야 한다 (커널 문서)
+    std::string spec = std::string(kind == PressureKind::Full ? "full " : "some ")
+                     + std::to_string(stall.count()) + " " + std::to_string(window.count());
+    if (::write(fd, spec.c_str(), spec.size() + 1) < 0) {
+        std::cerr << "PSI 트리거 등록 실패: " << path << " (" << spec << "): "
+                  << std::strerror(errno) << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    triggers_.push_back({fd, {resource, kind, stall, window}});
+    return true;
+#endif
+}
+
+std::vector<PressureTriggers::Event> PressureTriggers::wait(std::chrono::milliseconds timeout) {
+    std::vector<Event> events;
+#ifdef _WIN32
+    std::this_thread::sleep_for(timeout);
+#else
+    // 등록된(또는 남은) 트리거가 없어도 poll()이 timeout만큼 잠들어 호출 루프가 바쁘게 돌지 않는다
+    std::vector<pollfd> fds(triggers_.size());
+    for (size_t i = 0; i < triggers_.size(); ++i) {
+        fds[i] = {triggers_[i].fd, POLLPRI, 0};
+    }
+
+    int ready = ::poll(fds.data(), fds.size(), static_cast<int>(timeout.count()));
+    if (ready <= 0) {
+        return events;
+    }
+
+    for (size_t i = 0; i < fds.size(); ++i) {
+        if (fds[i].revents & POLLERR) {
+            // 감시 중인 cgroup이 사라짐
+            std::cerr << "PSI 트리거 해제됨: " << pressureResourceName(triggers_[i].event.resource) << std::endl;
+            ::close(triggers_[i].fd);
+            triggers_[i].fd = -1;
+        } else if (fds[i].revents & POLLPRI) {
+            events.push_back(triggers_[i].event);
+        }
+    }
+
+    std::erase_if(triggers_, [](const Trigger& trigger) { return trigger.fd < 0; });
+#endif
+    return events;
+}
+
+void PressureTriggers::close() {
+#ifndef _WIN32
+    for (auto& trigger : triggers_) {
+        if (trigger.fd >= 0) {
+            ::close(trigger.fd);
+        }
+    }
+#endif
+    triggers_.clear();
+}
+
+} // namespace sys
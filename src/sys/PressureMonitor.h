@@ -0,0 +1,116 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ProcFile.h"
+
+namespace sys {
+
+// PSI 자원 (파일 이름: cpu / memory / io)
+enum class PressureResource : uint8_t { Cpu, Memory, Io, Count };
+
+inline constexpr size_t kPressureResourceCount = static_cast<size_t>(PressureResource::Count);
+
+const char* pressureResourceName(PressureResource resource);
+
+// some: 하나 이상의 작업이 대기, full: 모든 non-idle 작업이 동시에 대기
+enum class PressureKind : uint8_t { Some, Full };
+
+// pressure 파일 한 줄
+struct PressureLine {
+    double avg10{0};
+    double avg60{0};
+    double avg300{0};
+    uint64_t total_us{0};   // 누적 정체 시간 (µs)
+};
+
+struct PressureStat {
+    PressureLine some;
+    PressureLine full;      // 오래된 커널의 cpu 파일에는 없음 (0)
+};
+
+// 두 샘플 사이 결과
+struct PressureUsage {
+    double some_avg10{0};
+    double full_avg10{0};
+    uint64_t some_stall_us{0};   // 직전 샘플 이후 누적 정체 증가분
+    uint64_t full_stall_us{0};
+};
+
+// Linux PSI(pressure stall information) 수집기
+// /proc/pressure/{cpu,memory,io}를 읽고, cgroup 디렉터리가 주어지면 그 cgroup의
+// {cpu,memory,io}.pressure를 우선 사용한다 (인코더만 제한된 cgroup에서 도는 경우).
+class PressureMonitor {
+public:
+    explicit PressureMonitor(std::string proc_dir = "/proc/pressure", std::string cgroup_dir = "");
+
+    // 모든 자원 새로 읽기, 하나라도 읽었으면 true
+    bool sample();
+
+    bool isAvailable(PressureResource resource) const { return resources_[index(resource)].available; }
+    const PressureUsage& get(PressureResource resource) const { return resources_[index(resource)].usage; }
+    const std::string& getPath(PressureResource resource) const { return resources_[index(resource)].file->getPath(); }
+
+    // 파일 내용 파싱 (테스트용 공개)
+    static bool parse(std::string_view text, PressureStat& stat);
+
+    // /proc/self/cgroup의 v2 경로 -> <cgroup_root>/<path>, PSI 파일이 없으면 빈 문자열
+    static std::string detectCgroupDir(const std::string& cgroup_root = "/sys/fs/cgroup");
+
+private:
+    static size_t index(PressureResource resource) { return static_cast<size_t>(resource); }
+
+    struct Resource {
+        std::unique_ptr<ProcFile> file;
+        PressureStat last;
+        PressureUsage usage;
+        bool primed{false};
+        bool available{false};
+    };
+
+    std::array<Resource, kPressureResourceCount> resources_;
+};
+
+// PSI 트리거: "<some|full> <stall us> <window us>"를 pressure 파일에 기록하면
+// window 안의 정체가 stall을 넘을 때 커널이 그 fd에 POLLPRI를 올린다.
+// 틱을 기다리지 않고 정체 순간에 깨어나기 위한 용도 (수집용 PressureMonitor와 별도 fd).
+class PressureTriggers {
+public:
+    struct Event {
+        PressureResource resource;
+        PressureKind kind;
+        std::chrono::microseconds stall;
+        std::chrono::microseconds window;
+    };
+
+    PressureTriggers() = default;
+    ~PressureTriggers();
+
+    // 트리거 등록 - 권한이 없거나(비특권은 window가 2초 배수여야 함) PSI가 없으면 false
+    bool add(const std::string& path, PressureResource resource, PressureKind kind,
+             std::chrono::microseconds stall, std::chrono::microseconds window);
+
+    // 트리거 발생 또는 timeout까지 대기, 발생한 트리거 목록 반환 (없으면 빈 목록)
+    // 트리거가 하나도 없으면 timeout만큼 잠든다
+    std::vector<Event> wait(std::chrono::milliseconds timeout);
+
+    size_t size() const { return triggers_.size(); }
+    void close();
+
+private:
+    PressureTriggers(const PressureTriggers&) = delete;
+    PressureTriggers& operator=(const PressureTriggers&) = delete;
+
+    struct Trigger {
+        int fd{-1};
+        Event event;
+    };
+
+    std::vector<Trigger> triggers_;
+};
+
+} // namespace sys
@@ -0,0 +1,65 @@
+#include "ProcFile.h"
+#include <cerrno>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace sys {
+
+ProcFile::ProcFile(std::string path)
+    : path_(std::move(path))
+    , buffer_(kInitialBufferSize) {}
+
+ProcFile::~ProcFile() {
+    close();
+}
+
+bool ProcFile::open() {
+#ifdef _WIN32
+    return false;  // /proc 없음
+#else
+    if (fd_ >= 0) return true;
+    fd_ = ::open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+    return fd_ >= 0;
+#endif
+}
+
+void ProcFile::close() {
+#ifndef _WIN32
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+#endif
+    fd_ = -1;
+}
+
+std::string_view ProcFile::read() {
+#ifdef _WIN32
+    return {};
+#else
+    if (!open()) return {};
+
+    // /proc 파일은 크기를 미리 알 수 없으므로, 버퍼가 가득 차면 키워서 다시 읽는다
+    while (true) {
+        size_t total = 0;
+        while (total < buffer_.size()) {
+            ssize_t n = ::pread(fd_, buffer_.data() + total, buffer_.size() - total,
+                                static_cast<off_t>(total));
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                close();  // 다음 호출에서 다시 열기
+                return {};
+            }
+            if (n == 0) {
+                return std::string_view(buffer_.data(), total);
+            }
+            total += static_cast<size_t>(n);
+        }
+        buffer_.resize(buffer_.size() * 2);
+    }
+#endif
+}
+
+} // namespace sys
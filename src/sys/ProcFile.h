@@ -0,0 +1,133 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sys {
+
+// 한 번 열어둔 /proc 파일을 pread(offset 0)로 반복해서 읽는다
+// 매 샘플마다 open/close 하지 않고, 읽기 버퍼도 재사용한다.
+class ProcFile {
+public:
+    static constexpr size_t kInitialBufferSize = 4096;
+
+    explicit ProcFile(std::string path);
+    ~ProcFile();
+
+    // 필요 시 열고 파일 전체를 읽음 - 실패하면 빈 view
+    // 반환된 view는 다음 read() 전까지 유효
+    std::string_view read();
+
+    bool isOpen() const { return fd_ >= 0; }
+    const std::string& getPath() const { return path_; }
+    void close();
+
+private:
+    ProcFile(const ProcFile&) = delete;
+    ProcFile& operator=(const ProcFile&) = delete;
+
+    bool open();
+
+    std::string path_;
+    int fd_{-1};
+    std::vector<char> buffer_;
+};
+
+// 공백 구분 /proc 텍스트용 스캐너 (할당/로케일 없음)
+class ProcScanner {
+public:
+    explicit ProcScanner(std::string_view text) : text_(text) {}
+
+    bool atEnd() const { return pos_ >= text_.size(); }
+
+    // 현재 줄의 남은 부분이 prefix로 시작하는지
+    bool startsWith(std::string_view prefix) const {
+        return text_.substr(pos_, prefix.size()) == prefix;
+    }
+
+    // 현재 줄에서 다음 단어 (줄 끝이면 빈 view)
+    std::string_view word() {
+        skipSpaces();
+        size_t start = pos_;
+        while (pos_ < text_.size() && !isSpace(text_[pos_]) && text_[pos_] != '\n') {
+            ++pos_;
+        }
+        return text_.substr(start, pos_ - start);
+    }
+
+    // 현재 줄에서 다음 부호 없는 정수, 숫자가 아니면 false
+    bool number(uint64_t& out) {
+        skipSpaces();
+        if (pos_ >= text_.size() || !isDigit(text_[pos_])) {
+            return false;
+        }
+        uint64_t value = 0;
+        while (pos_ < text_.size() && isDigit(text_[pos_])) {
+            value = value * 10 + static_cast<uint64_t>(text_[pos_] - '0');
+            ++pos_;
+        }
+        out = value;
+        return true;
+    }
+
+    // 소수점 숫자 (예: 12.56), 숫자가 아니면 false
+    bool decimal(double& out) {
+        uint64_t whole = 0;
+        if (!number(whole)) {
+            return false;
+        }
+        double value = static_cast<double>(whole);
+        if (pos_ < text_.size() && text_[pos_] == '.') {
+            ++pos_;
+            double scale = 0.1;
+            while (pos_ < text_.size() && isDigit(text_[pos_])) {
+                value += (text_[pos_] - '0') * scale;
+                scale *= 0.1;
+                ++pos_;
+            }
+        }
+        out = value;
+        return true;
+    }
+
+    // 공백 뒤 literal이 이어지면 건너뛰고 true (예: "avg10=")
+    bool expect(std::string_view literal) {
+        skipSpaces();
+        if (!startsWith(literal)) {
+            return false;
+        }
+        pos_ += literal.size();
+        return true;
+    }
+
+    // 현재 줄의 나머지를 건너뛰고 다음 줄 시작으로
+    void nextLine() {
+        while (pos_ < text_.size() && text_[pos_] != '\n') {
+            ++pos_;
+        }
+        if (pos_ < text_.size()) {
+            ++pos_;
+        }
+    }
+
+private:
+    static bool isSpace(char c) { return c == ' ' || c == '\t'; }
+    static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+    void skipSpaces() {
+        while (pos_ < text_.size() && isSpace(text_[pos_])) {
+            ++pos_;
+        }
+    }
+
+    std::string_view text_;
+    size_t pos_{0};
+};
+
+// 누적 카운터 증가분 - 카운터가 되감기면(32비트 넘침, cgroup 재생성 등) 0으로 취급
+constexpr uint64_t counterDelta(uint64_t before, uint64_t after) {
+    return after >= before ? after - before : 0;
+}
+
+} // namespace sys
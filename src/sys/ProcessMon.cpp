@@ -1,6 +1,6 @@
 #include "ProcessMon.h"
-#include <spdlog/spdlog.h>
 #include <algorithm>
+#include <iostream>
 #include <thread>
 #include <chrono>
 
@@ -14,9 +14,6 @@
 #else
 #include <sys/types.h>
 #include <sys/sysinfo.h>
-#include <dirent.h>
-#include <fstream>
-#include <sstream>
 #include <cstring>
 #endif
 
@@ -35,6 +32,7 @@ ProcessMonitor::ProcessMonitor() : lastUpdate_(std::chrono::steady_clock::now())
 }
 
 ProcessMonitor::~ProcessMonitor() {
+    stopExitWatch();
 #ifdef _WIN32
     if (cpuQuery_) PdhCloseQuery(cpuQuery_);
     if (gpuQuery_) PdhCloseQuery(gpuQuery_);
@@ -42,25 +40,155 @@ ProcessMonitor::~ProcessMonitor() {
 }
 
 void ProcessMonitor::addProcess(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
     if (std::find(monitoredProcesses_.begin(), monitoredProcesses_.end(), name) == monitoredProcesses_.end()) {
         monitoredProcesses_.push_back(name);
-        spdlog::info("Added process to monitor: {}", name);
+#ifndef _WIN32
+        tracker_.setNames(monitoredProcesses_);
+#endif
+        std::cout << "감시 프로세스 추가: " << name << std::endl;
     }
 }
 
 void ProcessMonitor::removeProcess(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
     auto it = std::find(monitoredProcesses_.begin(), monitoredProcesses_.end(), name);
     if (it != monitoredProcesses_.end()) {
         monitoredProcesses_.erase(it);
-        spdlog::info("Removed process from monitor: {}", name);
+#ifndef _WIN32
+        tracker_.setNames(monitoredProcesses_);
+#endif
+        std::cout << "감시 프로세스 제거: " << name << std::endl;
+    }
+}
+
+#ifndef _WIN32
+namespace {
+// 추적기 상태 -> ProcUsage (CPU%, RSS, 스레드 수는 refresh()에서 stat 한 번으로 갱신됨)
+ProcUsage toUsage(const sys::TrackedProcess& process) {
+    ProcUsage usage;
+    usage.name = process.name;
+    usage.running = process.running;
+    usage.pid = process.pid;
+    usage.cpu_pct = process.cpu_pct;
+    usage.mem_mb = static_cast<double>(process.rss_bytes) / (1024 * 1024);
+    usage.threads = static_cast<int>(process.threads);
+    for (const auto& thread : process.top_threads) {
+        usage.top_threads.push_back({thread.tid, std::string(thread.getName()), thread.cpu_pct});
+    }
+    usage.perf_active = process.perf_active;
+    usage.context_switches_per_sec = process.context_switches_per_sec;
+    usage.cpu_migrations_per_sec = process.cpu_migrations_per_sec;
+    usage.page_faults_per_sec = process.page_faults_per_sec;
+    usage.task_clock_cores = process.task_clock_cores;
+    usage.io_active = process.io_active;
+    usage.read_bytes_per_sec = process.read_bytes_per_sec;
+    usage.write_bytes_per_sec = process.write_bytes_per_sec;
+    usage.read_syscalls_per_sec = process.read_syscalls_per_sec;
+    usage.write_syscalls_per_sec = process.write_syscalls_per_sec;
+    usage.cancelled_write_bytes = process.cancelled_write_bytes;
+    return usage;
+}
+
+ProcExit toExit(const sys::ProcessExit& exit, bool via_pidfd) {
+    return {exit.name, exit.pid, exit.restarted_pid, via_pidfd};
+}
+}
+#endif
+
+void ProcessMonitor::setThreadTopN(size_t top_n) {
+#ifdef _WIN32
+    (void)top_n;
+#else
+    std::lock_guard<std::mutex> lock(mutex_);
+    tracker_.setThreadTopN(top_n);
+#endif
+}
+
+void ProcessMonitor::setPerfCounters(bool enabled) {
+#ifdef _WIN32
+    (void)enabled;
+#else
+    std::lock_guard<std::mutex> lock(mutex_);
+    tracker_.setPerfCounters(enabled);
+#endif
+}
+
+bool ProcessMonitor::startExitWatch(ExitCallback callback) {
+#ifdef _WIN32
+    (void)callback;
+    return false;
+#else
+    if (exitRunning_) {
+        return true;
+    }
+    bool supported;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        exitCallback_ = std::move(callback);
+        supported = tracker_.enableExitWatch();
+    }
+    if (!supported) {
+        std::cerr << "pidfd 종료 감시 미지원 - 프로세스 종료는 다음 수집 주기에 감지" << std::endl;
+        return false;
+    }
+
+    exitRunning_ = true;
+    exitThread_ = std::thread([this]() {
+        // 감시기는 추적기가 소유하고 wait()는 잠금 없이 기다린다 (수집 틱을 막지 않음)
+        auto* watcher = tracker_.getExitWatcher();
+        while (exitRunning_) {
+            auto pids = watcher->wait(std::chrono::milliseconds(500));
+            if (pids.empty()) continue;
+
+            std::vector<sys::ProcessExit> exits;
+            ExitCallback callback;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                exits = tracker_.handleExits(pids);
+                callback = exitCallback_;
+            }
+            for (const auto& exit : exits) {
+                std::cerr << "감시 프로세스 종료: " << exit.name << " (pid " << exit.pid << ")" << std::endl;
+                if (callback) callback(toExit(exit, true));
+            }
+        }
+    });
+    return true;
+#endif
+}
+
+void ProcessMonitor::stopExitWatch() {
+    exitRunning_ = false;
+    if (exitThread_.joinable()) {
+        exitThread_.join();
     }
 }
 
 std::vector<ProcUsage> ProcessMonitor::getProcessStats() {
     std::vector<ProcUsage> stats;
+#ifdef _WIN32
     for (const auto& name : monitoredProcesses_) {
         stats.push_back(QueryProcess(name));
     }
+#else
+    // 캐시된 PID만 확인 - 전체 /proc 순회는 PID가 사라졌을 때만
+    std::vector<sys::ProcessExit> lost;
+    ExitCallback callback;   // 수집 스레드에서 불리므로 잠금 안에서 복사 (startExitWatch와 경합)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tracker_.refresh();
+        for (const auto& process : tracker_.getProcesses()) {
+            stats.push_back(toUsage(process));
+        }
+        lost = tracker_.takeLost();
+        if (!lost.empty()) callback = exitCallback_;
+    }
+    // pidfd보다 stat 확인이 먼저 발견한 종료 (또는 pidfd 미지원 커널)
+    for (const auto& exit : lost) {
+        if (callback) callback(toExit(exit, false));
+    }
+#endif
     return stats;
 }
 
@@ -77,10 +205,14 @@ ProcUsage QueryProcess(const std::string& name) {
     PROCESSENTRY32 pe32;
     pe32.dwSize = sizeof(PROCESSENTRY32);
     
+    // "=obs64.exe"는 실행 파일 이름 전체 일치, 그 외는 부분 문자열 (sys::NameMatcher와 같은 규칙)
+    bool exact = !name.empty() && name[0] == '=';
+    std::string pattern = exact ? name.substr(1) : name;
+    
     if (Process32First(hSnapshot, &pe32)) {
         do {
             std::string processName = pe32.szExeFile;
-            if (processName.find(name) != std::string::npos) {
+            if (exact ? processName == pattern : processName.find(pattern) != std::string::npos) {
                 usage.running = true;
                 usage.pid = pe32.th32ProcessID;
                 
@@ -103,52 +235,34 @@ ProcUsage QueryProcess(const std::string& name) {
 }
 #else
 ProcUsage QueryProcess(const std::string& name) {
-    ProcUsage usage;
-    usage.name = name;
-    
-    DIR* dir = opendir("/proc");
-    if (!dir) {
-        return usage;
-    }
-    
-    struct dirent* entry;
-    while ((entry = readdir(dir)) != nullptr) {
-        if (entry->d_type == DT_DIR && isdigit(entry->d_name[0])) {
-            std::string procPath = "/proc/" + std::string(entry->d_name);
-            std::string commPath = procPath + "/comm";
-            
-            std::ifstream commFile(commPath);
-            if (commFile.is_open()) {
-                std::string processName;
-                std::getline(commFile, processName);
-                commFile.close();
-                
-                if (processName.find(name) != std::string::npos) {
-                    usage.running = true;
-                    usage.pid = std::stoi(entry->d_name);
-                    
-                    // 메모리 사용량 측정
-                    std::string statmPath = procPath + "/statm";
-                    std::ifstream statmFile(statmPath);
-                    if (statmFile.is_open()) {
-                        unsigned long pages;
-                        statmFile >> pages;
-                        statmFile.close();
-                        usage.mem_mb = static_cast<double>(pages * 4096) / (1024 * 1024);
-                    }
-                    break;
-                }
-            }
-        }
-    }
-    
-    closedir(dir);
-    return usage;
+    // 일회성 조회 - 샘플이 하나뿐이라 cpu_pct는 0, 반복 조회는 ProcessMonitor를 쓴다
+    sys::ProcessTracker tracker;
+    tracker.setNames({name});
+    tracker.refresh();
+    return toUsage(tracker.getProcesses().front());
 }
 #endif
 
 // 시스템 전체 리소스 모니터링 메서드들 추가
 SystemMetrics ProcessMonitor::getSystemMetrics() {
+    // 개별 접근자가 각자 /proc을 다시 읽지 않도록 epoch마다 한 번만 샘플
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    auto now = std::chrono::steady_clock::now();
+    if (!snapshotValid_ || now - snapshotAt_ >= snapshotEpoch_) {
+        snapshot_ = sampleSystemMetrics();
+        snapshotAt_ = now;
+        snapshotValid_ = true;
+    }
+    return snapshot_;
+}
+
+void ProcessMonitor::setSnapshotEpoch(std::chrono::milliseconds epoch) {
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    snapshotEpoch_ = epoch;
+    snapshotValid_ = false;
+}
+
+SystemMetrics ProcessMonitor::sampleSystemMetrics() {
     SystemMetrics metrics;
     
 #ifdef _WIN32
@@ -179,37 +293,15 @@ SystemMetrics ProcessMonitor::getSystemMetrics() {
     }
     
 #else
-    // Linux 시스템 모니터링
-    std::ifstream statFile("/proc/stat");
-    if (statFile.is_open()) {
-        std::string line;
-        std::getline(statFile, line);
-        statFile.close();
-        
-        // CPU 사용률 계산 (간단한 방법)
-        metrics.cpu_pct = 25.0; // 임시값
-    }
+    // Linux 시스템 모니터링 - 직전 호출과의 /proc/stat 차이로 계산
+    cpuSampler_.sample();
+    metrics.cpu_pct = cpuSampler_.getTotal().total_pct;
     
     // 메모리 사용량
-    std::ifstream meminfoFile("/proc/meminfo");
-    if (meminfoFile.is_open()) {
-        std::string line;
-        unsigned long total = 0, available = 0;
-        
-        while (std::getline(meminfoFile, line)) {
-            if (line.find("MemTotal:") != std::string::npos) {
-                sscanf(line.c_str(), "MemTotal: %lu", &total);
-            } else if (line.find("MemAvailable:") != std::string::npos) {
-                sscanf(line.c_str(), "MemAvailable: %lu", &available);
-                break;
-            }
-        }
-        meminfoFile.close();
-        
-        if (total > 0) {
-            metrics.mem_mb = static_cast<double>(total - available) / 1024.0;
-            metrics.mem_total_mb = static_cast<double>(total) / 1024.0;
-        }
+    sys::MemInfo memInfo;
+    if (memInfo_.read(memInfo)) {
+        metrics.mem_mb = static_cast<double>(memInfo.usedKb()) / 1024.0;
+        metrics.mem_total_mb = static_cast<double>(memInfo.total_kb) / 1024.0;
     }
     
     // GPU 사용률 (Linux에서는 nvidia-smi 사용)
@@ -2,17 +2,55 @@
 #include <string>
 #include <vector>
 #include <chrono>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 #ifdef _WIN32
 #include <pdh.h>
+#else
+#include "CpuSampler.h"
+#include "MemInfo.h"
+#include "ProcessTracker.h"
 #endif
 
+struct ThreadCpu {
+    int tid{0};
+    std::string name;        // 스레드 이름 (예: obs-x264, libobs: graphics thread)
+    double cpu_pct{0};       // 한 코어 기준
+};
+
 struct ProcUsage { 
     bool running{false}; 
-    double cpu_pct{0}; 
-    double mem_mb{0}; 
+    double cpu_pct{0};       // 시스템 전체 CPU 대비 (Linux)
+    double mem_mb{0};        // RSS
+    std::string name;
+    int pid{0};
+    int threads{0};
+    std::vector<ThreadCpu> top_threads;   // setThreadTopN() > 0 일 때 CPU 상위 스레드
+    // perf 소프트웨어 카운터 (setPerfCounters(true), Linux) - 스케줄링 간섭 신호
+    bool perf_active{false};
+    double context_switches_per_sec{0};
+    double cpu_migrations_per_sec{0};
+    double page_faults_per_sec{0};
+    double task_clock_cores{0};      // task-clock 기준 사용 코어 수
+    // /proc/<pid>/io (Linux, 같은 사용자 프로세스만) - 로컬 녹화 정체 감지용
+    bool io_active{false};
+    double read_bytes_per_sec{0};    // 저장 장치 기준 (소켓 송신 제외)
+    double write_bytes_per_sec{0};
+    double read_syscalls_per_sec{0};
+    double write_syscalls_per_sec{0};
+    uint64_t cancelled_write_bytes{0};
+};
+
+// 감시 프로세스 종료 이벤트
+struct ProcExit {
     std::string name;
     int pid{0};
+    int restarted_pid{0};    // 즉시 재순회로 다시 찾은 PID (0 = 아직 재시작 안 됨)
+    bool via_pidfd{false};   // false = 다음 틱의 stat 확인에서 발견
 };
 
 struct SystemMetrics {
@@ -31,24 +69,48 @@ public:
     
     void addProcess(const std::string& name);
     void removeProcess(const std::string& name);
+    void setThreadTopN(size_t top_n);     // 0 = 스레드별 수집 끔 (Linux)
+    void setPerfCounters(bool enabled);   // perf_event_open 소프트웨어 카운터 (Linux)
     std::vector<ProcUsage> getProcessStats();
+
+    // 종료 감시 스레드 시작 (Linux pidfd), 종료 즉시 콜백 후 재시작된 프로세스에 다시 붙는다
+    // pidfd 미지원이면 getProcessStats()에서 발견한 종료만 같은 콜백으로 보낸다
+    using ExitCallback = std::function<void(const ProcExit&)>;
+    bool startExitWatch(ExitCallback callback);
+    void stopExitWatch();
     
-    // 시스템 전체 리소스 모니터링
+    // 시스템 전체 리소스 모니터링 - epoch 안의 호출은 같은 스냅샷을 돌려준다
     SystemMetrics getSystemMetrics();
     double getCpuUsage();
     double getGpuUsage();
     double getMemoryUsage();
+    void setSnapshotEpoch(std::chrono::milliseconds epoch);
     
 private:
+    SystemMetrics sampleSystemMetrics();
+
     std::vector<std::string> monitoredProcesses_;
     std::chrono::steady_clock::time_point lastUpdate_;
     std::vector<ProcUsage> lastStats_;
+    SystemMetrics snapshot_;
+    std::chrono::steady_clock::time_point snapshotAt_{};
+    std::chrono::milliseconds snapshotEpoch_{500};
+    bool snapshotValid_{false};
+    std::mutex mutex_;             // 감시 목록/추적기 (종료 감시 스레드와 공유)
+    std::mutex snapshotMutex_;     // 시스템 스냅샷과 그 샘플러 - tracker_.refresh() 중에도 기다리지 않게 분리
+    ExitCallback exitCallback_;
+    std::thread exitThread_;
+    std::atomic<bool> exitRunning_{false};
     
 #ifdef _WIN32
     PDH_HQUERY cpuQuery_{nullptr};
     PDH_HCOUNTER cpuCounter_{nullptr};
     PDH_HQUERY gpuQuery_{nullptr};
     PDH_HCOUNTER gpuCounter_{nullptr};
+#else
+    sys::CpuSampler cpuSampler_;   // /proc/stat 열어둔 채 재사용
+    sys::MemInfoReader memInfo_;   // /proc/meminfo 열어둔 채 재사용
+    sys::ProcessTracker tracker_;  // 감시 이름 전체를 한 번에 찾고 PID 캐시
 #endif
 };
 
@@ -0,0 +1,448 @@
+#include "ProcessTracker.h"
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace sys {
+
+namespace {
+// 순회 중 /proc/<pid>/stat 하나를 읽는 스택 버퍼 크기 (stat 한 줄은 보통 300바이트 안팎)
+constexpr size_t kStatBufferSize = 1024;
+// takeLost()를 부르지 않는 사용처에서 종료 기록이 계속 쌓이지 않게
+constexpr size_t kMaxLost = 16;
+
+bool parseField(std::string_view word, uint64_t& value) {
+    auto result = std::from_chars(word.data(), word.data() + word.size(), value);
+    return result.ec == std::errc();
+}
+
+bool parsePid(const char* text, int& pid) {
+    auto end = text + std::strlen(text);
+    auto result = std::from_chars(text, end, pid);
+    return result.ec == std::errc() && result.ptr == end && pid > 0;
+}
+
+bool isGone(const ProcStat& stat) {
+    // 좀비/종료 중인 프로세스는 실행 중으로 보지 않는다
+    return stat.state == 'Z' || stat.state == 'X' || stat.state == 'x';
+}
+}
+
+void NameMatcher::compile(const std::vector<std::string>& names) {
+    names_.assign(names.begin(), names.begin() + std::min(names.size(), kMaxNames));
+    first_byte_.fill(0);
+    exact_ = 0;
+    for (size_t i = 0; i < names_.size(); ++i) {
+        if (!names_[i].empty() && names_[i][0] == '=') {
+            names_[i].erase(0, 1);
+            exact_ |= uint64_t{1} << i;
+        } else if (!names_[i].empty()) {
+            first_byte_[static_cast<unsigned char>(names_[i][0])] |= uint64_t{1} << i;
+        }
+    }
+}
+
+uint64_t NameMatcher::allMask() const {
+    return names_.size() == kMaxNames ? ~uint64_t{0} : (uint64_t{1} << names_.size()) - 1;
+}
+
+uint64_t NameMatcher::match(std::string_view comm, uint64_t candidates) const {
+    uint64_t matched = 0;
+    for (uint64_t bits = candidates & exact_; bits; bits &= bits - 1) {
+        int i = std::countr_zero(bits);
+        if (comm == names_[i]) {
+            matched |= uint64_t{1} << i;
+        }
+    }
+    for (size_t pos = 0; pos < comm.size(); ++pos) {
+        uint64_t bits = first_byte_[static_cast<unsigned char>(comm[pos])] & candidates & ~matched;
+        while (bits) {
+            int i = std::countr_zero(bits);
+            bits &= bits - 1;
+            if (comm.substr(pos, names_[i].size()) == names_[i]) {
+                matched |= uint64_t{1} << i;
+            }
+        }
+    }
+    return matched;
+}
+
+ProcessTracker::ProcessTracker(std::string proc_root, std::chrono::milliseconds rescan_interval)
+    : proc_root_(std::move(proc_root))
+    , rescan_interval_(rescan_interval) {
+#ifndef _WIN32
+    // 페이지 크기는 arm64 등에서 4096이 아닐 수 있다
+    long ticks = sysconf(_SC_CLK_TCK);
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    long page = sysconf(_SC_PAGESIZE);
+    if (ticks > 0) ticks_per_second_ = static_cast<double>(ticks);
+    if (cpus > 0) online_cpus_ = static_cast<double>(cpus);
+    if (page > 0) page_size_ = static_cast<uint64_t>(page);
+#endif
+}
+
+ProcessTracker::~ProcessTracker() = default;
+
+void ProcessTracker::setNames(const std::vector<std::string>& names) {
+    for (size_t i = 0; i < processes_.size(); ++i) {
+        if (processes_[i].running) detach(i);
+    }
+    matcher_.compile(names);
+    processes_.clear();
+    entries_.clear();
+    processes_.resize(matcher_.size());
+    entries_.resize(matcher_.size());
+    for (size_t i = 0; i < processes_.size(); ++i) {
+        processes_[i].name = names[i];
+    }
+    scanned_ = false;
+}
+
+void ProcessTracker::setThreadTopN(size_t top_n) {
+    thread_top_n_ = top_n;
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        entries_[i].threads.reset();
+        processes_[i].top_threads.clear();
+        if (top_n > 0 && processes_[i].running) {
+            entries_[i].threads = std::make_unique<ThreadSampler>(
+                proc_root_ + "/" + std::to_string(processes_[i].pid) + "/task", top_n);
+        }
+    }
+}
+
+void ProcessTracker::setPerfCounters(bool enabled) {
+    perf_enabled_ = enabled;
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        entries_[i].perf.reset();
+        entries_[i].state.perf = PerfSample{};
+        processes_[i].perf_active = false;
+        processes_[i].context_switches_per_sec = processes_[i].cpu_migrations_per_sec = 0;
+        processes_[i].page_faults_per_sec = processes_[i].task_clock_cores = 0;
+        if (enabled && processes_[i].running) {
+            openPerf(i);
+        }
+    }
+}
+
+void ProcessTracker::openPerf(size_t index) {
+    auto perf = std::make_unique<PerfGroup>(processes_[index].pid);
+    if (perf->isOpen()) {
+        entries_[index].perf = std::move(perf);
+        processes_[index].perf_active = true;
+    }
+}
+
+bool ProcessTracker::refresh(Clock::time_point now) {
+    // 캐시된 PID 검증 + 사용량 갱신 - 사라진 것이 있으면 즉시 전체 순회
+    uint64_t missing = 0;
+    bool lost = false;
+    for (size_t i = 0; i < processes_.size(); ++i) {
+        if (processes_[i].running && !update(i, now)) {
+            if (lost_.size() < kMaxLost) {
+                lost_.push_back({processes_[i].name, processes_[i].pid, 0});
+            }
+            detach(i);
+            lost = true;
+        }
+        if (!processes_[i].running) {
+            missing |= uint64_t{1} << i;
+        }
+    }
+
+    if (missing == 0) {
+        return false;
+    }
+    // 아직 못 찾은 이름은 rescan_interval마다만 다시 찾는다 (실행 전 대기 중인 OBS 등)
+    if (!lost && scanned_ && now - last_scan_ < rescan_interval_) {
+        return false;
+    }
+
+    rescan(missing, now);
+    for (auto& exit : lost_) {
+        if (exit.restarted_pid == 0) exit.restarted_pid = findPid(exit.name);
+    }
+    return true;
+}
+
+int ProcessTracker::findPid(const std::string& name) const {
+    for (const auto& process : processes_) {
+        if (process.running && process.name == name) return process.pid;
+    }
+    return 0;
+}
+
+std::vector<ProcessExit> ProcessTracker::takeLost() {
+    std::vector<ProcessExit> lost;
+    lost.swap(lost_);
+    return lost;
+}
+
+void ProcessTracker::rescan(uint64_t missing, Clock::time_point now) {
+    scan(missing, now);
+    last_scan_ = now;
+    scanned_ = true;
+    ++scan_count_;
+}
+
+bool ProcessTracker::enableExitWatch() {
+    if (!exit_watcher_) {
+        exit_watcher_ = std::make_unique<ExitWatcher>();
+        for (const auto& process : processes_) {
+            if (process.running) exit_watcher_->watch(process.pid);
+        }
+    }
+    return exit_watcher_->isSupported();
+}
+
+std::vector<ProcessExit> ProcessTracker::handleExits(const std::vector<int>& pids, Clock::time_point now) {
+    std::vector<ProcessExit> exits;
+    uint64_t missing = 0;
+    for (size_t i = 0; i < processes_.size(); ++i) {
+        auto& process = processes_[i];
+        if (process.running && std::find(pids.begin(), pids.end(), process.pid) != pids.end()) {
+            exits.push_back({process.name, process.pid, 0});
+            detach(i);
+        }
+        if (!processes_[i].running) {
+            missing |= uint64_t{1} << i;
+        }
+    }
+    if (exits.empty()) {
+        return exits;
+    }
+
+    // 재시작 대기 없이 바로 한 번 찾아본다 (크래시 후 자동 재시작 등)
+    rescan(missing, now);
+    for (auto& exit : exits) {
+        exit.restarted_pid = findPid(exit.name);
+    }
+    return exits;
+}
+
+bool ProcessTracker::update(size_t index, Clock::time_point now) {
+    auto& file = entries_[index].stat;
+    if (!file) return false;
+
+    // 종료된 프로세스의 열린 stat은 읽기 실패(ESRCH), PID가 재사용됐으면 시작 시각이 다르다
+    std::string_view comm;
+    ProcStat stat;
+    auto text = file->read();
+    if (text.empty() || !parseStat(text, comm, stat) || isGone(stat)
+        || stat.start_time != processes_[index].start_time) {
+        return false;
+    }
+    record(index, stat, now);
+    return true;
+}
+
+void ProcessTracker::record(size_t index, const ProcStat& stat, Clock::time_point now) {
+    auto& process = processes_[index];
+    auto& state = entries_[index].state;
+    uint64_t ticks = stat.utime + stat.stime;
+
+    // 단조 시계 기준 경과 시간으로 나눈다 (틱 지연과 무관)
+    double seconds = std::chrono::duration<double>(now - state.sampled_at).count();
+    if (state.primed && seconds > 0) {
+        uint64_t delta = counterDelta(state.cpu_ticks, ticks);
+        process.cpu_cores = static_cast<double>(delta) / ticks_per_second_ / seconds;
+        process.cpu_pct = process.cpu_cores / online_cpus_ * 100.0;
+    }
+    if (auto& perf = entries_[index].perf) {
+        // 그룹 read() 한 번으로 네 카운터
+        PerfSample sample;
+        // time_enabled == 0 이면 아직 기준값이 없다 (방금 열었음)
+        if (perf->read(sample) && state.perf.time_enabled > 0 && seconds > 0) {
+            auto rate = [seconds](uint64_t current, uint64_t previous) {
+                return static_cast<double>(counterDelta(previous, current)) / seconds;
+            };
+            process.context_switches_per_sec = rate(sample.context_switches, state.perf.context_switches);
+            process.cpu_migrations_per_sec = rate(sample.cpu_migrations, state.perf.cpu_migrations);
+            process.page_faults_per_sec = rate(sample.page_faults, state.perf.page_faults);
+            process.task_clock_cores = rate(sample.task_clock_ns, state.perf.task_clock_ns) / 1e9;
+        }
+        state.perf = sample;
+    }
+    if (auto& io_file = entries_[index].io) {
+        // CPU와 같은 기준 시각/경과 시간으로 I/O 비율 계산
+        ProcIo io;
+        process.io_active = parseIo(io_file->read(), io);
+        if (process.io_active) {
+            if (state.primed && seconds > 0) {
+                auto rate = [seconds](uint64_t current, uint64_t previous) {
+                    return static_cast<double>(counterDelta(previous, current)) / seconds;
+                };
+                process.read_bytes_per_sec = rate(io.read_bytes, state.io.read_bytes);
+                process.write_bytes_per_sec = rate(io.write_bytes, state.io.write_bytes);
+                process.read_syscalls_per_sec = rate(io.syscr, state.io.syscr);
+                process.write_syscalls_per_sec = rate(io.syscw, state.io.syscw);
+            }
+            process.cancelled_write_bytes = io.cancelled_write_bytes;
+            state.io = io;
+        } else {
+            process.read_bytes_per_sec = process.write_bytes_per_sec = 0;
+            process.read_syscalls_per_sec = process.write_syscalls_per_sec = 0;
+        }
+    }
+    process.rss_bytes = stat.rss_pages * page_size_;
+    process.threads = stat.threads;
+    if (auto& threads = entries_[index].threads) {
+        threads->sample(now);
+        process.top_threads = threads->getTop();   // 용량 안에서 복사
+    }
+
+    state.cpu_ticks = ticks;
+    state.sampled_at = now;
+    state.primed = true;
+}
+
+void ProcessTracker::attach(size_t index, int pid, const ProcStat& stat, Clock::time_point now) {
+    auto& process = processes_[index];
+    process.pid = pid;
+    process.start_time = stat.start_time;
+    process.running = true;
+    process.cpu_pct = process.cpu_cores = 0;
+    entries_[index].stat = std::make_unique<ProcFile>(proc_root_ + "/" + std::to_string(pid) + "/stat");
+    entries_[index].io = std::make_unique<ProcFile>(proc_root_ + "/" + std::to_string(pid) + "/io");
+    entries_[index].state = ProcessState{};
+    if (thread_top_n_ > 0) {
+        entries_[index].threads = std::make_unique<ThreadSampler>(
+            proc_root_ + "/" + std::to_string(pid) + "/task", thread_top_n_);
+        process.top_threads.reserve(thread_top_n_);
+    }
+    if (exit_watcher_) {
+        exit_watcher_->watch(pid);
+    }
+    if (perf_enabled_) {
+        openPerf(index);
+    }
+    record(index, stat, now);
+}
+
+void ProcessTracker::detach(size_t index) {
+    auto& process = processes_[index];
+    if (exit_watcher_ && process.running) {
+        // 같은 PID를 다른 이름이 함께 잡고 있으면 감시를 유지한다
+        int pid = process.pid;
+        process.running = false;
+        if (std::none_of(processes_.begin(), processes_.end(),
+                         [pid](const TrackedProcess& other) { return other.running && other.pid == pid; })) {
+            exit_watcher_->unwatch(pid);
+        }
+    }
+    std::string name = std::move(process.name);
+    process = TrackedProcess{};
+    process.name = std::move(name);
+    entries_[index].stat.reset();
+    entries_[index].io.reset();
+    entries_[index].threads.reset();
+    entries_[index].perf.reset();
+    entries_[index].state = ProcessState{};
+}
+
+void ProcessTracker::scan(uint64_t wanted, Clock::time_point now) {
+#ifdef _WIN32
+    (void)wanted;
+    (void)now;
+#else
+    DIR* dir = opendir(proc_root_.c_str());
+    if (!dir) {
+        return;
+    }
+
+    char path[512];
+    char buffer[kStatBufferSize];
+    struct dirent* entry;
+    while (wanted != 0 && (entry = readdir(dir)) != nullptr) {
+        int pid = 0;
+        if (!parsePid(entry->d_name, pid)) continue;
+
+        // comm과 시작 시각을 stat 한 번으로 읽는다 (문자열 할당 없음)
+        int length = std::snprintf(path, sizeof(path), "%s/%s/stat", proc_root_.c_str(), entry->d_name);
+        if (length <= 0 || static_cast<size_t>(length) >= sizeof(path)) continue;
+        int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) continue;  // 순회 중 종료됨
+        ssize_t n = ::read(fd, buffer, sizeof(buffer));
+        ::close(fd);
+        if (n <= 0) continue;
+
+        std::string_view comm;
+        ProcStat stat;
+        if (!parseStat(std::string_view(buffer, static_cast<size_t>(n)), comm, stat) || isGone(stat)) continue;
+
+        uint64_t matched = matcher_.match(comm, wanted);
+        while (matched) {
+            int i = std::countr_zero(matched);
+            matched &= matched - 1;
+            attach(static_cast<size_t>(i), pid, stat, now);
+            wanted &= ~(uint64_t{1} << i);
+        }
+    }
+    closedir(dir);
+#endif
+}
+
+bool ProcessTracker::parseStat(std::string_view text, std::string_view& comm, ProcStat& stat) {
+    // "pid (comm) state ppid ..." - comm에 공백/괄호가 들어갈 수 있어 마지막 ')'로 자른다
+    auto open = text.find('(');
+    auto close = text.rfind(')');
+    if (open == std::string_view::npos || close == std::string_view::npos || close < open) {
+        return false;
+    }
+    comm = text.substr(open + 1, close - open - 1);
+
+    ProcScanner scanner(text.substr(close + 1));
+    auto state = scanner.word();
+    if (state.empty()) {
+        return false;
+    }
+    stat.state = state[0];
+
+    // 필드 번호는 proc(5) 기준 (음수 필드가 있어 단어 단위로 읽는다)
+    for (int field = 4; field <= 24; ++field) {
+        auto word = scanner.word();
+        if (word.empty()) return false;
+        switch (field) {
+            case 14: parseField(word, stat.utime); break;
+            case 15: parseField(word, stat.stime); break;
+            case 20: parseField(word, stat.threads); break;
+            case 22: if (!parseField(word, stat.start_time)) return false; break;
+            case 24: parseField(word, stat.rss_pages); break;
+            default: break;
+        }
+    }
+    return true;
+}
+
+bool ProcessTracker::parseIo(std::string_view text, ProcIo& io) {
+    // "rchar: 123\nwchar: 456\nsyscr: ..." - 필요한 키만 읽는다
+    ProcScanner scanner(text);
+    int found = 0;
+    while (!scanner.atEnd()) {
+        auto key = scanner.word();
+        uint64_t value = 0;
+        if (scanner.number(value)) {
+            uint64_t* field = nullptr;
+            if (key == "syscr:") field = &io.syscr;
+            else if (key == "syscw:") field = &io.syscw;
+            else if (key == "read_bytes:") field = &io.read_bytes;
+            else if (key == "write_bytes:") field = &io.write_bytes;
+            else if (key == "cancelled_write_bytes:") field = &io.cancelled_write_bytes;
+            if (field) {
+                *field = value;
+                ++found;
+            }
+        }
+        scanner.nextLine();
+    }
+    return found == 5;
+}
+
+} // namespace sys
@@ -0,0 +1,186 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ExitWatcher.h"
+#include "PerfCounters.h"
+#include "ProcFile.h"
+#include "ThreadSampler.h"
+
+namespace sys {
+
+// 여러 이름을 한 번에 찾는 부분 문자열 매처 (최대 64개)
+// 첫 바이트별 후보 비트마스크를 미리 만들어, comm 한 번 훑을 때 모든 이름을 함께 비교한다.
+// "=obs"처럼 '='로 시작하는 이름은 comm 전체가 같을 때만 맞는다 (obs-ffmpeg-mux 등 보조 프로세스 제외).
+class NameMatcher {
+public:
+    static constexpr size_t kMaxNames = 64;
+
+    void compile(const std::vector<std::string>& names);
+
+    // comm에 포함된 이름들의 비트마스크 (candidates에 속한 이름만 비교)
+    uint64_t match(std::string_view comm, uint64_t candidates = ~uint64_t{0}) const;
+
+    size_t size() const { return names_.size(); }
+    uint64_t allMask() const;
+
+private:
+    std::vector<std::string> names_;     // '=' 접두사를 뗀 비교 문자열
+    std::array<uint64_t, 256> first_byte_{};
+    uint64_t exact_{0};                  // 전체 일치 이름 비트
+};
+
+// /proc/<pid>/stat에서 필요한 필드
+struct ProcStat {
+    char state{0};
+    uint64_t utime{0};            // clock tick
+    uint64_t stime{0};
+    uint64_t threads{0};
+    uint64_t start_time{0};       // 부팅 후 clock tick - PID 재사용 판별
+    uint64_t rss_pages{0};
+};
+
+// /proc/<pid>/io 누적값 (같은 사용자 프로세스만 읽을 수 있다)
+struct ProcIo {
+    uint64_t syscr{0};
+    uint64_t syscw{0};
+    uint64_t read_bytes{0};               // 저장 장치까지 간 바이트 (소켓/파이프 제외)
+    uint64_t write_bytes{0};
+    uint64_t cancelled_write_bytes{0};    // 기록 전 잘리거나 지워져 취소된 쓰기
+};
+
+// 감시 중인 이름 하나의 현재 프로세스
+struct TrackedProcess {
+    std::string name;
+    int pid{0};
+    uint64_t start_time{0};
+    bool running{false};
+
+    double cpu_pct{0};            // 시스템 전체 CPU 대비 (시스템 cpu_pct와 같은 기준)
+    double cpu_cores{0};          // 사용 코어 수 (top의 %CPU / 100)
+    uint64_t rss_bytes{0};
+    uint64_t threads{0};
+    std::vector<ThreadUsage> top_threads;   // setThreadTopN() > 0 일 때만
+
+    // perf 소프트웨어 카운터 (setPerfCounters(true) 이고 열기에 성공했을 때만)
+    bool perf_active{false};
+    double context_switches_per_sec{0};
+    double cpu_migrations_per_sec{0};
+    double page_faults_per_sec{0};
+    double task_clock_cores{0};   // task-clock 기준 사용 코어 수 (틱 단위 stat보다 정밀)
+
+    // /proc/<pid>/io (권한이 없으면 io_active = false)
+    bool io_active{false};
+    double read_bytes_per_sec{0};
+    double write_bytes_per_sec{0};
+    double read_syscalls_per_sec{0};
+    double write_syscalls_per_sec{0};
+    uint64_t cancelled_write_bytes{0};
+};
+
+// pidfd로 감지한 종료 한 건
+struct ProcessExit {
+    std::string name;
+    int pid{0};
+    int restarted_pid{0};         // 곧바로 다시 찾은 새 PID (0 = 아직 없음)
+};
+
+// PID별 샘플 간 상태 - PID가 바뀌면 초기화
+struct ProcessState {
+    uint64_t cpu_ticks{0};        // utime + stime
+    PerfSample perf;
+    ProcIo io;
+    std::chrono::steady_clock::time_point sampled_at{};
+    bool primed{false};
+};
+
+// 감시 대상 프로세스 추적기
+// /proc 전체 순회는 한 번에 모든 이름을 매칭하고, 찾은 PID는 /proc/<pid>/stat을 열어둔 채
+// 시작 시각으로 재검증한다. 캐시된 PID가 사라졌을 때(또는 아직 못 찾은 이름이 있으면
+// rescan_interval마다)만 다시 전체 순회하므로 평소 비용은 감시 프로세스 수에 비례한다.
+// enableExitWatch()를 켜면 종료는 다음 refresh를 기다리지 않고 pidfd로 바로 알 수 있다.
+class ProcessTracker {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit ProcessTracker(std::string proc_root = "/proc",
+                            std::chrono::milliseconds rescan_interval = std::chrono::milliseconds(2000));
+    ~ProcessTracker();
+
+    // 감시 이름 교체 (캐시 초기화, 다음 refresh에서 전체 순회)
+    void setNames(const std::vector<std::string>& names);
+
+    // 스레드별 CPU 상위 N개 수집 (0 = 끔, /proc/<pid>/task 순회 비용이 든다)
+    void setThreadTopN(size_t top_n);
+    size_t getThreadTopN() const { return thread_top_n_; }
+
+    // 프로세스별 perf 소프트웨어 카운터 그룹 (문맥 전환/CPU 이주/페이지 폴트/task-clock)
+    void setPerfCounters(bool enabled);
+    bool getPerfCounters() const { return perf_enabled_; }
+
+    // 캐시 검증/사용량 갱신(프로세스당 stat pread 한 번) + 필요 시 전체 순회, 전체 순회를 했으면 true
+    bool refresh() { return refresh(Clock::now()); }
+    bool refresh(Clock::time_point now);
+
+    // pidfd 종료 감시 켜기 (커널 5.3+), 미지원이면 false - 그때는 refresh()의 stat 확인만 쓴다
+    bool enableExitWatch();
+    // 대기용 감시기 (enableExitWatch 전에는 nullptr), wait()는 다른 스레드에서 불러도 된다
+    ExitWatcher* getExitWatcher() { return exit_watcher_.get(); }
+    // 종료된 PID 분리 후 즉시 전체 순회로 재시작된 프로세스에 다시 붙는다
+    std::vector<ProcessExit> handleExits(const std::vector<int>& pids) { return handleExits(pids, Clock::now()); }
+    std::vector<ProcessExit> handleExits(const std::vector<int>& pids, Clock::time_point now);
+    // refresh()의 stat 확인에서 먼저 발견한 종료 (pidfd 대기보다 앞선 경우 포함), 꺼내면 비워진다
+    std::vector<ProcessExit> takeLost();
+
+    const std::vector<TrackedProcess>& getProcesses() const { return processes_; }
+    uint64_t getScanCount() const { return scan_count_; }
+    const std::string& getProcRoot() const { return proc_root_; }
+
+    // stat 한 줄 파싱 (테스트용 공개), comm은 text 안을 가리킨다
+    static bool parseStat(std::string_view text, std::string_view& comm, ProcStat& stat);
+    // /proc/<pid>/io 파싱 (테스트용 공개)
+    static bool parseIo(std::string_view text, ProcIo& io);
+
+private:
+    ProcessTracker(const ProcessTracker&) = delete;
+    ProcessTracker& operator=(const ProcessTracker&) = delete;
+
+    struct Entry {
+        std::unique_ptr<ProcFile> stat;   // 찾은 PID의 /proc/<pid>/stat (열어둔 채 재사용)
+        std::unique_ptr<ProcFile> io;     // /proc/<pid>/io
+        std::unique_ptr<ThreadSampler> threads;
+        std::unique_ptr<PerfGroup> perf;
+        ProcessState state;
+    };
+
+    bool update(size_t index, Clock::time_point now);
+    void record(size_t index, const ProcStat& stat, Clock::time_point now);
+    void attach(size_t index, int pid, const ProcStat& stat, Clock::time_point now);
+    void detach(size_t index);
+    void openPerf(size_t index);
+    void scan(uint64_t wanted, Clock::time_point now);
+    void rescan(uint64_t missing, Clock::time_point now);
+    int findPid(const std::string& name) const;
+
+    std::string proc_root_;
+    double ticks_per_second_{100};
+    double online_cpus_{1};
+    uint64_t page_size_{4096};
+    std::chrono::milliseconds rescan_interval_;
+    size_t thread_top_n_{0};
+    bool perf_enabled_{false};
+    std::unique_ptr<ExitWatcher> exit_watcher_;
+    NameMatcher matcher_;
+    std::vector<TrackedProcess> processes_;
+    std::vector<Entry> entries_;
+    std::vector<ProcessExit> lost_;
+    Clock::time_point last_scan_{};
+    bool scanned_{false};
+    uint64_t scan_count_{0};
+};
+
+} // namespace sys
@@ -0,0 +1,26 @@
+#include "RecordingStall.h"
+
+namespace sys {
+
+bool RecordingStallDetector::update(bool recording, bool io_active, double write_bytes_per_sec,
+                                    Clock::time_point now) {
+    if (!recording || !io_active || write_bytes_per_sec > 0.0) {
+        stall_start_.reset();
+        reported_ = false;
+        return false;
+    }
+    if (!stall_start_) {
+        stall_start_ = now;
+    }
+    if (reported_ || now - *stall_start_ < threshold_) {
+        return false;
+    }
+    reported_ = true;
+    return true;
+}
+
+RecordingStallDetector::Clock::duration RecordingStallDetector::stalledFor(Clock::time_point now) const {
+    return stall_start_ ? now - *stall_start_ : Clock::duration::zero();
+}
+
+} // namespace sys
@@ -0,0 +1,31 @@
+#pragma once
+#include <chrono>
+#include <optional>
+
+namespace sys {
+
+// 녹화 중 쓰기 정체 감지 (/proc/<pid>/io write_bytes 기준)
+// 정체 시작 시각을 steady_clock으로 기록하므로 판정은 호출 주기와 무관하게 경과 시간으로 한다.
+class RecordingStallDetector {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit RecordingStallDetector(Clock::duration threshold = std::chrono::seconds(3))
+        : threshold_(threshold) {}
+
+    void setThreshold(Clock::duration threshold) { threshold_ = threshold; }
+
+    // 정체가 threshold를 넘긴 첫 호출에서만 true (쓰기가 재개되거나 녹화가 끝날 때까지 다시 알리지 않음)
+    // io_active = false (권한 없음 등)이면 쓰기 0과 구분할 수 없으므로 판단하지 않는다
+    bool update(bool recording, bool io_active, double write_bytes_per_sec, Clock::time_point now);
+
+    // 현재 이어지고 있는 정체 시간 (정체 중이 아니면 0)
+    Clock::duration stalledFor(Clock::time_point now) const;
+
+private:
+    Clock::duration threshold_;
+    std::optional<Clock::time_point> stall_start_;
+    bool reported_{false};
+};
+
+} // namespace sys
@@ -0,0 +1,223 @@
+#include "ThreadSampler.h"
+#include "ProcessTracker.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace sys {
+
+namespace {
+constexpr size_t kStatBufferSize = 1024;
+constexpr size_t kDirentBufferSize = 16384;
+
+#ifndef _WIN32
+// getdents64 레코드 (glibc는 이 구조체를 공개하지 않는다)
+struct LinuxDirent64 {
+    uint64_t d_ino;
+    int64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[1];
+};
+#endif
+}
+
+ThreadTable::ThreadTable(size_t capacity) {
+    size_t size = 16;
+    while (size < capacity) size *= 2;
+    slots_.resize(size);
+}
+
+size_t ThreadTable::home(int32_t tid) const {
+    // 곱셈 해시 - 연속 TID가 이웃 슬롯에 몰리지 않게
+    return static_cast<size_t>((static_cast<uint32_t>(tid) * 2654435761u) >> 8) & (slots_.size() - 1);
+}
+
+ThreadSlot& ThreadTable::findOrInsert(int32_t tid, bool& inserted) {
+    // 적재율 1/2 초과 시 확장
+    if ((size_ + 1) * 2 > slots_.size()) {
+        grow();
+    }
+    size_t mask = slots_.size() - 1;
+    for (size_t i = home(tid);; i = (i + 1) & mask) {
+        auto& slot = slots_[i];
+        if (slot.tid == tid) {
+            inserted = false;
+            return slot;
+        }
+        if (slot.tid == 0) {
+            slot = ThreadSlot{};
+            slot.tid = tid;
+            ++size_;
+            inserted = true;
+            return slot;
+        }
+    }
+}
+
+const ThreadSlot* ThreadTable::find(int32_t tid) const {
+    size_t mask = slots_.size() - 1;
+    for (size_t i = home(tid);; i = (i + 1) & mask) {
+        const auto& slot = slots_[i];
+        if (slot.tid == tid) return &slot;
+        if (slot.tid == 0) return nullptr;
+    }
+}
+
+void ThreadTable::grow() {
+    std::vector<ThreadSlot> old(slots_.size() * 2);
+    old.swap(slots_);
+    size_ = 0;
+    for (const auto& slot : old) {
+        if (slot.tid == 0) continue;
+        bool inserted = false;
+        findOrInsert(slot.tid, inserted) = slot;
+    }
+}
+
+void ThreadTable::eraseAt(size_t index) {
+    size_t mask = slots_.size() - 1;
+    size_t hole = index;
+    for (size_t j = (hole + 1) & mask; slots_[j].tid != 0; j = (j + 1) & mask) {
+        // j의 원소가 hole 위치로 와도 탐사 경로가 끊기지 않으면 당긴다
+        size_t k = home(slots_[j].tid);
+        bool stays = hole <= j ? (hole < k && k <= j) : (hole < k || k <= j);
+        if (!stays) {
+            slots_[hole] = slots_[j];
+            hole = j;
+        }
+    }
+    slots_[hole] = ThreadSlot{};
+    --size_;
+}
+
+void ThreadTable::sweep(uint32_t generation) {
+    for (size_t i = 0; i < slots_.size();) {
+        if (slots_[i].tid != 0 && slots_[i].seen != generation) {
+            eraseAt(i);  // 당겨온 원소를 다시 확인
+        } else {
+            ++i;
+        }
+    }
+}
+
+ThreadSampler::ThreadSampler(std::string task_dir, size_t top_n)
+    : task_dir_(std::move(task_dir))
+    , top_n_(top_n)
+    , dirent_buffer_(kDirentBufferSize) {
+    top_.reserve(top_n_ + 1);
+#ifndef _WIN32
+    long ticks = sysconf(_SC_CLK_TCK);
+    if (ticks > 0) ticks_per_second_ = static_cast<double>(ticks);
+    dir_fd_ = ::open(task_dir_.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+#endif
+}
+
+ThreadSampler::~ThreadSampler() {
+#ifndef _WIN32
+    if (dir_fd_ >= 0) {
+        ::close(dir_fd_);
+    }
+#endif
+}
+
+bool ThreadSampler::sample(Clock::time_point now) {
+    top_.clear();
+#ifdef _WIN32
+    (void)now;
+    return false;
+#else
+    if (dir_fd_ < 0 || ::lseek(dir_fd_, 0, SEEK_SET) < 0) {
+        return false;
+    }
+
+    double seconds = std::chrono::duration<double>(now - last_time_).count();
+    bool rates = primed_ && seconds > 0;
+    ++generation_;
+
+    char buffer[kStatBufferSize];
+    bool any = false;
+    while (true) {
+        long bytes = ::syscall(SYS_getdents64, dir_fd_, dirent_buffer_.data(), dirent_buffer_.size());
+        if (bytes <= 0) break;
+
+        for (long offset = 0; offset < bytes;) {
+            auto* entry = reinterpret_cast<const LinuxDirent64*>(dirent_buffer_.data() + offset);
+            offset += entry->d_reclen;
+
+            const char* name = entry->d_name;
+            int32_t tid = 0;
+            auto end = name + std::strlen(name);
+            auto parsed = std::from_chars(name, end, tid);
+            if (parsed.ec != std::errc() || parsed.ptr != end || tid <= 0) continue;
+
+            // <tid>/stat - 경로 문자열 없이 디렉터리 fd 기준으로 연다
+            char path[32];
+            std::memcpy(path, name, static_cast<size_t>(end - name));
+            std::memcpy(path + (end - name), "/stat", 6);
+            int fd = ::openat(dir_fd_, path, O_RDONLY | O_CLOEXEC);
+            if (fd < 0) continue;  // 샘플 중 종료된 스레드
+            ssize_t n = ::read(fd, buffer, sizeof(buffer));
+            ::close(fd);
+            if (n <= 0) continue;
+
+            std::string_view comm;
+            ProcStat stat;
+            if (!ProcessTracker::parseStat(std::string_view(buffer, static_cast<size_t>(n)), comm, stat)) continue;
+
+            bool inserted = false;
+            auto& slot = table_.findOrInsert(tid, inserted);
+            uint64_t ticks = stat.utime + stat.stime;
+            if (!inserted && rates) {
+                uint64_t delta = counterDelta(slot.ticks, ticks);
+                if (delta > 0) {
+                    offer(slot, static_cast<double>(delta) / ticks_per_second_ / seconds * 100.0);
+                }
+            }
+            // 스레드 이름은 바뀔 수 있다 (pthread_setname_np)
+            size_t length = std::min(comm.size(), slot.name.size() - 1);
+            std::memcpy(slot.name.data(), comm.data(), length);
+            slot.name[length] = '\0';
+            slot.ticks = ticks;
+            slot.seen = generation_;
+            any = true;
+        }
+    }
+
+    table_.sweep(generation_);
+    last_time_ = now;
+    primed_ = true;
+
+    // 상위 목록 이름은 슬롯 갱신 뒤 채운다
+    for (auto& usage : top_) {
+        if (const auto* slot = table_.find(usage.tid)) {
+            usage.name = slot->name;
+        }
+    }
+    return any;
+#endif
+}
+
+void ThreadSampler::offer(const ThreadSlot& slot, double cpu_pct) {
+    // 작은 N에 대한 삽입 정렬 (reserve된 용량 안에서만 움직임)
+    if (top_n_ == 0 || (top_.size() == top_n_ && cpu_pct <= top_.back().cpu_pct)) {
+        return;
+    }
+    ThreadUsage usage;
+    usage.tid = slot.tid;
+    usage.cpu_pct = cpu_pct;
+    auto position = std::upper_bound(top_.begin(), top_.end(), cpu_pct,
+                                     [](double value, const ThreadUsage& other) { return value > other.cpu_pct; });
+    top_.insert(position, usage);
+    if (top_.size() > top_n_) {
+        top_.pop_back();
+    }
+}
+
+} // namespace sys
@@ -0,0 +1,90 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sys {
+
+// 스레드별 누적 상태 슬롯 (tid 0 = 빈 슬롯)
+struct ThreadSlot {
+    int32_t tid{0};
+    uint32_t seen{0};               // 마지막으로 보인 샘플 번호
+    uint64_t ticks{0};              // utime + stime
+    std::array<char, 16> name{};    // comm (최대 15자 + NUL)
+};
+
+// TID 키 열린 주소법(선형 탐사) 테이블
+// 스레드 수가 늘 때만 두 배로 커지고, 같은 규모로 반복 샘플링하면 할당이 없다.
+// 삭제는 묘비 없이 뒤쪽 원소를 당겨 채운다(backward shift).
+class ThreadTable {
+public:
+    explicit ThreadTable(size_t capacity = 64);
+
+    // tid 슬롯 (없으면 새로 만들고 inserted = true)
+    ThreadSlot& findOrInsert(int32_t tid, bool& inserted);
+    const ThreadSlot* find(int32_t tid) const;
+
+    // seen != generation 인 슬롯 제거 (사라진 스레드)
+    void sweep(uint32_t generation);
+
+    size_t size() const { return size_; }
+    size_t capacity() const { return slots_.size(); }
+
+private:
+    size_t home(int32_t tid) const;
+    void grow();
+    void eraseAt(size_t index);
+
+    std::vector<ThreadSlot> slots_;
+    size_t size_{0};
+};
+
+// 상위 스레드 한 개
+struct ThreadUsage {
+    int tid{0};
+    std::array<char, 16> name{};
+    double cpu_pct{0};              // 한 코어 기준 (top -H 와 같음)
+
+    std::string_view getName() const { return name.data(); }
+};
+
+// /proc/<pid>/task/*/stat 기반 스레드별 CPU 상위 N개
+// task 디렉터리는 열어둔 채 getdents64로 다시 읽고, stat은 고정 버퍼로 읽는다.
+class ThreadSampler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    ThreadSampler(std::string task_dir, size_t top_n);
+    ~ThreadSampler();
+
+    // 새 샘플, 프로세스가 사라졌으면 false
+    bool sample() { return sample(Clock::now()); }
+    bool sample(Clock::time_point now);
+
+    // CPU 차이 내림차순 상위 N개 (차이가 0인 스레드는 제외)
+    const std::vector<ThreadUsage>& getTop() const { return top_; }
+    size_t getThreadCount() const { return table_.size(); }
+    const ThreadTable& getTable() const { return table_; }
+
+private:
+    ThreadSampler(const ThreadSampler&) = delete;
+    ThreadSampler& operator=(const ThreadSampler&) = delete;
+
+    void offer(const ThreadSlot& slot, double cpu_pct);
+
+    std::string task_dir_;
+    int dir_fd_{-1};
+    size_t top_n_;
+    double ticks_per_second_{100};
+    ThreadTable table_;
+    std::vector<ThreadUsage> top_;
+    std::vector<char> dirent_buffer_;
+    uint32_t generation_{0};
+    Clock::time_point last_time_{};
+    bool primed_{false};
+};
+
+} // namespace sys
@@ -0,0 +1,52 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace test {
+
+// 테스트용 임시 디렉터리 트리 (/proc, cgroupfs 흉내) - 소멸 시 통째로 삭제
+// 이름에 난수 + 카운터를 붙여 같은 테스트가 병렬로 돌아도 서로의 트리를 지우지 않는다.
+class TempTree {
+public:
+    explicit TempTree(std::string_view prefix) : root_(makeUniqueDir(prefix)) {}
+    ~TempTree() {
+        std::error_code ec;
+        std::filesystem::remove_all(root_, ec);
+    }
+
+    TempTree(const TempTree&) = delete;
+    TempTree& operator=(const TempTree&) = delete;
+
+    const std::filesystem::path& root() const { return root_; }
+    std::filesystem::path path(const std::filesystem::path& relative) const { return root_ / relative; }
+
+    // 상위 디렉터리까지 만들고 파일 내용을 통째로 교체
+    void write(const std::filesystem::path& relative, const std::string& text) const {
+        auto target = path(relative);
+        std::filesystem::create_directories(target.parent_path());
+        std::ofstream(target, std::ios::trunc) << text;
+    }
+    void mkdir(const std::filesystem::path& relative) const { std::filesystem::create_directories(path(relative)); }
+    void remove(const std::filesystem::path& relative) const { std::filesystem::remove_all(path(relative)); }
+
+private:
+    static std::filesystem::path makeUniqueDir(std::string_view prefix) {
+        static std::atomic<uint32_t> counter{0};
+        std::random_device random;
+        auto base = std::filesystem::temp_directory_path();
+        for (;;) {
+            auto dir = base / (std::string(prefix) + "_" + std::to_string(random()) + "_" + std::to_string(counter++));
+            // 이미 있으면 false - 다른 이름으로 다시 시도
+            if (std::filesystem::create_directories(dir)) return dir;
+        }
+    }
+
+    std::filesystem::path root_;
+};
+
+} // namespace test
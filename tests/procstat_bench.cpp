@@ -0,0 +1,68 @@
+// /proc/stat 파싱 비교: 매번 ifstream + istringstream vs 열어둔 fd + pread + 수동 스캐너
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../src/sys/CpuSampler.h"
+
+namespace {
+
+// 기존 방식: 매 샘플마다 파일을 열고 스트림으로 cpu 줄을 파싱
+double ifstreamSample(std::vector<unsigned long long>& prev) {
+    std::ifstream file("/proc/stat");
+    std::string line;
+    std::vector<unsigned long long> cur;
+    while (std::getline(file, line) && line.rfind("cpu", 0) == 0) {
+        std::istringstream iss(line);
+        std::string label;
+        iss >> label;
+        unsigned long long value;
+        for (int i = 0; i < 8 && (iss >> value); ++i) {
+            cur.push_back(value);
+        }
+    }
+
+    double busy = 0;
+    if (prev.size() == cur.size() && cur.size() >= 8) {
+        unsigned long long total = 0, idle = 0;
+        for (int i = 0; i < 8; ++i) total += cur[i] - prev[i];
+        idle = (cur[3] - prev[3]) + (cur[4] - prev[4]);
+        busy = total ? 100.0 * static_cast<double>(total - idle) / static_cast<double>(total) : 0.0;
+    }
+    prev.swap(cur);
+    return busy;
+}
+
+template <typename Fn>
+void run(const char* name, int iterations, Fn&& fn) {
+    double sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        sink += fn();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    std::cout << name << ": " << static_cast<double>(ns) / iterations / 1000.0
+              << " us/sample (checksum " << sink << ")" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    constexpr int kIterations = 20000;
+
+    std::vector<unsigned long long> prev;
+    run("ifstream + istringstream", kIterations, [&] {
+        return ifstreamSample(prev);
+    });
+
+    sys::CpuSampler sampler("/proc/stat", std::chrono::milliseconds(0));
+    run("CpuSampler (pread)      ", kIterations, [&] {
+        sampler.sample();
+        return sampler.getTotal().total_pct;
+    });
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+// metrics JSONL 직렬화 마이크로벤치마크: nlohmann DOM 경로 vs 고정 스키마 직렬화기
+// 전역 operator new를 가로채 틱당 힙 할당 횟수를 센다.
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include "../src/ipc/MetricsSerializer.h"
+
+namespace {
+std::atomic<size_t> g_allocations{0};
+}
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+
+core::MetricFrame sampleLine(int i) {
+    core::MetricFrame line;
+    line.ts = 1792146164 + i;
+    line[core::MetricId::CpuPct] = 12.5 + i % 50;
+    line[core::MetricId::MemoryPct] = 24.535477526374798;
+    line[core::MetricId::MemMb] = 1475.51953125 + i;
+    line[core::MetricId::GpuPct] = 3.0;
+    line[core::MetricId::RttMs] = 36.78949989509777 + (i % 7) * 0.1;
+    line[core::MetricId::LossPct] = 0.25;
+    line[core::MetricId::UplinkKbps] = 7797.860985808279;
+    line[core::MetricId::TickLateMs] = 0.35;
+    return line;
+}
+
+template <typename Fn>
+void run(const char* name, int iterations, Fn&& fn) {
+    size_t bytes = 0;
+    size_t before = g_allocations.load();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        bytes += fn(i);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    size_t allocations = g_allocations.load() - before;
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    std::cout << name << ": "
+              << static_cast<double>(ns) / iterations << " ns/tick, "
+              << static_cast<double>(allocations) / iterations << " allocs/tick"
+              << " (" << bytes / iterations << " bytes/line)" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    constexpr int kIterations = 200000;
+
+    run("nlohmann::json dump", kIterations, [](int i) {
+        auto line = sampleLine(i);
+        // DOM 경로 (스키마 필드 수와 무관하게 같은 필드로 비교)
+        std::string text = ipc::toJson(line).dump();
+        return text.size() + 1;
+    });
+
+    ipc::MetricsSerializer serializer;
+    run("MetricsSerializer  ", kIterations, [&](int i) {
+        return serializer.serialize(sampleLine(i)).size();
+    });
+
+    return 0;
+}
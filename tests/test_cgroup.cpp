@@ -0,0 +1,123 @@
+#include <doctest/doctest.h>
+#include "../src/sys/CgroupMonitor.h"
+#include "TempTree.h"
+#include <filesystem>
+#include <string>
+
+namespace fs = std::filesystem;
+using namespace std::chrono_literals;
+
+namespace {
+// 가짜 cgroupfs: <root>/sys/fs/cgroup/<path>/... + <root>/self_cgroup
+struct FakeCgroupFs {
+    test::TempTree tree;
+    fs::path root;
+    fs::path cgroup_root;
+    fs::path relative;   // root 기준 cgroup 디렉터리
+    fs::path dir;
+
+    FakeCgroupFs(const char* name, const std::string& path)
+        : tree(name)
+        , root(tree.root())
+        , cgroup_root(root / "cgroup")
+        , relative(fs::path("cgroup") / path)
+        , dir(root / relative) {
+        tree.mkdir(relative);
+        tree.write("cgroup/cgroup.controllers", "cpu io memory pids\n");
+        tree.write("self_cgroup", "0::/" + path + "\n");
+    }
+
+    void file(const char* name, const std::string& text) { tree.write(relative / name, text); }
+
+    void cpuStat(uint64_t usage_usec, uint64_t periods, uint64_t throttled) {
+        file("cpu.stat", "usage_usec " + std::to_string(usage_usec) + "\n"
+                         "user_usec " + std::to_string(usage_usec / 2) + "\n"
+                         "system_usec " + std::to_string(usage_usec / 2) + "\n"
+                         "nr_periods " + std::to_string(periods) + "\n"
+                         "nr_throttled " + std::to_string(throttled) + "\n"
+                         "throttled_usec " + std::to_string(throttled * 1000) + "\n");
+    }
+};
+}
+
+TEST_SUITE("CgroupMonitor") {
+    TEST_CASE("Own cgroup is found from /proc/self/cgroup") {
+        CHECK(sys::cgroupPathOf("12:pids:/docker/abc\n0::/system.slice/encoder.service\n")
+              == "/system.slice/encoder.service");
+        CHECK(sys::cgroupPathOf("12:pids:/\n").empty());   // v1 전용
+
+        FakeCgroupFs fake("liveops_cgroup_find", "kubepods/pod1/ctr");
+        auto dir = sys::findCgroupDir(fake.cgroup_root.string(), (fake.root / "self_cgroup").string());
+        CHECK(dir == fake.dir.string());
+    }
+
+    TEST_CASE("Hybrid hierarchy uses the unified mount") {
+        test::TempTree tree("liveops_cgroup_hybrid");
+        tree.write("unified/cgroup.controllers", "");
+        tree.write("self_cgroup", "1:name=systemd:/\n0::/\n");
+
+        CHECK(sys::findCgroupDir(tree.root().string(), tree.path("self_cgroup").string()) == tree.path("unified").string());
+    }
+
+    TEST_CASE("Limits are parsed with max meaning unlimited") {
+        double cores = 0;
+        CHECK(sys::CgroupMonitor::parseCpuMax("150000 100000\n", cores));
+        CHECK(cores == doctest::Approx(1.5));
+        CHECK_FALSE(sys::CgroupMonitor::parseCpuMax("max 100000\n", cores));
+
+        uint64_t bytes = 0;
+        CHECK(sys::CgroupMonitor::parseMemoryValue("536870912\n", bytes));
+        CHECK(bytes == 536870912);
+        CHECK_FALSE(sys::CgroupMonitor::parseMemoryValue("max\n", bytes));
+
+        CHECK(sys::CgroupMonitor::parseInactiveFile("anon 100\nfile 200\ninactive_anon 0\ninactive_file 150\n") == 150);
+
+        sys::CgroupCounters counters;
+        CHECK(sys::CgroupMonitor::parseIoStat(
+            "8:0 rbytes=1000 wbytes=2000 rios=10 wios=20 dbytes=0 dios=0\n"
+            "259:0 rbytes=500 wbytes=0 rios=5 wios=0 dbytes=0 dios=0\n", counters));
+        CHECK(counters.io_rbytes == 1500);
+        CHECK(counters.io_wbytes == 2000);
+        CHECK(counters.io_rios == 15);
+        CHECK(counters.io_wios == 20);
+    }
+
+    TEST_CASE("Utilisation is computed against the cgroup quota") {
+        FakeCgroupFs fake("liveops_cgroup_usage", "encoder");
+        fake.cpuStat(1000000, 100, 0);
+        fake.file("cpu.max", "200000 100000\n");           // 2코어
+        fake.file("memory.current", "1073741824\n");       // 1 GiB
+        fake.file("memory.max", "2147483648\n");           // 2 GiB
+        fake.file("memory.stat", "anon 805306368\ninactive_file 268435456\n");
+        fake.file("io.stat", "8:0 rbytes=0 wbytes=0 rios=0 wios=0\n");
+
+        auto monitor = sys::CgroupMonitor::forSelf(fake.cgroup_root.string(), (fake.root / "self_cgroup").string());
+        REQUIRE(monitor);
+
+        auto t0 = sys::CgroupMonitor::Clock::now();
+        CHECK_FALSE(monitor->sample(t0));   // 첫 샘플은 기준값
+
+        // 1초 동안 1.5코어 사용, 10주기 중 4주기 스로틀, 4 MiB 쓰기
+        fake.cpuStat(2500000, 110, 4);
+        fake.file("io.stat", "8:0 rbytes=0 wbytes=4194304 rios=0 wios=64\n");
+        REQUIRE(monitor->sample(t0 + 1s));
+
+        const auto& usage = monitor->getUsage();
+        CHECK(usage.cpu_limit_cores == doctest::Approx(2.0));
+        CHECK(usage.cpu_cores == doctest::Approx(1.5));
+        CHECK(usage.cpu_pct == doctest::Approx(75.0));
+        CHECK(usage.throttled_pct == doctest::Approx(40.0));
+        CHECK(usage.throttled_usec == 4000);
+        CHECK(usage.mem_working_set == 805306368);       // current - inactive_file
+        CHECK(usage.mem_pct == doctest::Approx(37.5));
+        CHECK(usage.io_write_bps == doctest::Approx(4194304.0));
+        CHECK(usage.io_write_iops == doctest::Approx(64.0));
+    }
+
+    TEST_CASE("Missing cgroup files make the sample invalid") {
+        test::TempTree tree("liveops_cgroup_missing");
+        sys::CgroupMonitor monitor(tree.path("missing").string());
+        CHECK_FALSE(monitor.sample());
+        CHECK_FALSE(monitor.isValid());
+    }
+}
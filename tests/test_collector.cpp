@@ -0,0 +1,96 @@
+#include <doctest/doctest.h>
+#include "../src/core/Collector.h"
+#include "../src/core/SpscRing.h"
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+TEST_SUITE("Collector pipeline") {
+    TEST_CASE("SpscRing preserves order across threads") {
+        static core::SpscRing<uint64_t, 8> ring;
+        constexpr uint64_t kCount = 100000;
+
+        std::thread producer([] {
+            for (uint64_t i = 0; i < kCount; ++i) {
+                while (!ring.push(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        uint64_t expected = 0;
+        bool ordered = true;
+        while (expected < kCount) {
+            uint64_t value;
+            if (ring.pop(value)) {
+                ordered = ordered && (value == expected);
+                ++expected;
+            }
+        }
+        producer.join();
+
+        CHECK(ordered);
+        CHECK(ring.size() == 0);
+    }
+
+    TEST_CASE("SpscRing rejects pushes when full") {
+        core::SpscRing<int, 4> ring;
+        for (int i = 0; i < 4; ++i) {
+            CHECK(ring.push(i));
+        }
+        CHECK_FALSE(ring.push(99));
+
+        int value = -1;
+        CHECK(ring.pop(value));
+        CHECK(value == 0);
+        CHECK(ring.push(4));
+    }
+
+    TEST_CASE("Aggregator holds back samples newer than the tick deadline") {
+        auto origin = std::chrono::steady_clock::now();
+        core::Collector collector("fast", 10ms, [](core::SourceSample& sample) {
+            sample.metrics.values[0] = static_cast<double>(sample.sequence);
+        }, origin);
+        core::Aggregator aggregator;
+        int source = aggregator.addSource(collector);
+
+        collector.start();
+        std::this_thread::sleep_for(80ms);
+        collector.stop();
+
+        auto deadline = origin + 35ms;
+        aggregator.join(deadline);
+        REQUIRE(aggregator.hasSample(source));
+        CHECK(aggregator.latest(source).timestamp <= deadline);
+        CHECK(aggregator.latest(source).metrics.values[0] == doctest::Approx(3.0));
+
+        aggregator.join(origin + 1s);
+        CHECK(aggregator.latest(source).metrics.values[0] >= 6.0);
+    }
+
+    TEST_CASE("Slow source does not delay a fast source") {
+        auto origin = std::chrono::steady_clock::now();
+        core::Collector slow("slow", 20ms, [](core::SourceSample&) {
+            std::this_thread::sleep_for(200ms);
+        }, origin);
+        core::Collector fast("fast", 10ms, [](core::SourceSample& sample) {
+            sample.metrics.values[0] = 1.0;
+        }, origin);
+        core::Aggregator aggregator;
+        int slow_id = aggregator.addSource(slow);
+        int fast_id = aggregator.addSource(fast);
+
+        slow.start();
+        fast.start();
+        std::this_thread::sleep_for(100ms);
+
+        aggregator.join(std::chrono::steady_clock::now());
+        CHECK(aggregator.hasSample(fast_id));
+        CHECK_FALSE(aggregator.hasSample(slow_id));
+        CHECK(fast.getStats()[0].fired >= 5);
+
+        fast.stop();
+        slow.stop();
+    }
+}
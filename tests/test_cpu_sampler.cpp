@@ -0,0 +1,114 @@
+#include <doctest/doctest.h>
+#include "../src/sys/CpuSampler.h"
+#include "../src/sys/ProcFile.h"
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+// user nice system idle iowait irq softirq steal
+const char* kStatBefore =
+    "cpu  1000 0 500 8000 100 0 0 0 0 0\n"
+    "cpu0 500 0 250 4000 50 0 0 0 0 0\n"
+    "cpu1 500 0 250 4000 50 0 0 0 0 0\n"
+    "intr 12345 0 0\n"
+    "ctxt 999\n";
+
+// 100 jiffies/core 경과: cpu0은 포화(user), cpu1은 iowait 40 + steal 10 + idle 50
+const char* kStatAfter =
+    "cpu  1100 0 500 8050 140 0 0 10 0 0\n"
+    "cpu0 600 0 250 4000 50 0 0 0 0 0\n"
+    "cpu1 500 0 250 4050 90 0 0 10 0 0\n"
+    "intr 12399 0 0\n"
+    "ctxt 1200\n";
+
+std::string tempPath(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+}
+
+TEST_SUITE("CpuSampler") {
+    TEST_CASE("Usage is computed from counter deltas") {
+        sys::CpuSampler sampler;
+        CHECK_FALSE(sampler.update(kStatBefore));  // 첫 샘플은 기준값
+        REQUIRE(sampler.update(kStatAfter));
+
+        const auto& total = sampler.getTotal();
+        CHECK(total.total_pct == doctest::Approx(55.0));   // (200 - 50 idle - 40 iowait) / 200
+        CHECK(total.user_pct == doctest::Approx(50.0));
+        CHECK(total.iowait_pct == doctest::Approx(20.0));
+        CHECK(total.steal_pct == doctest::Approx(5.0));
+        CHECK(total.system_pct == doctest::Approx(0.0));
+
+        REQUIRE(sampler.getCoreCount() == 2);
+        CHECK(sampler.getCores().busy_pct[0] == doctest::Approx(100.0));
+        CHECK(sampler.getCores().busy_pct[1] == doctest::Approx(10.0));
+        CHECK(sampler.getCores().iowait_pct[1] == doctest::Approx(40.0));
+        CHECK(sampler.getCores().steal_pct[1] == doctest::Approx(10.0));
+    }
+
+    TEST_CASE("Per-core batch clamps rewound counters") {
+        // SIMD 폭의 배수가 아닌 코어 수로 나머지 처리까지 확인
+        constexpr size_t kCores = 11;
+        sys::CoreCounters prev;
+        sys::CoreCounters cur;
+        prev.resize(kCores);
+        cur.resize(kCores);
+        for (size_t i = 0; i < kCores; ++i) {
+            prev.busy[i] = 1000;
+            prev.idle[i] = 1000;
+            prev.iowait[i] = 500;
+            cur.busy[i] = 1000 + i * 10;
+            cur.idle[i] = 1000 + 100 - i * 10;
+            cur.iowait[i] = 500;
+        }
+        cur.iowait[3] = 400;  // iowait 되감김 -> 0으로 취급
+        cur.idle[5] = 1000;   // 경과 없음이 섞여도 0 나눗셈 없음
+        cur.busy[5] = 1000;
+
+        sys::CoreUsage usage;
+        sys::computeCoreUsage(prev, cur, usage);
+
+        REQUIRE(usage.size() == kCores);
+        CHECK(usage.busy_pct[0] == doctest::Approx(0.0));
+        CHECK(usage.busy_pct[3] == doctest::Approx(30.0));
+        CHECK(usage.iowait_pct[3] == doctest::Approx(0.0));
+        CHECK(usage.busy_pct[5] == doctest::Approx(0.0));
+        CHECK(usage.busy_pct[10] == doctest::Approx(100.0));
+    }
+
+    TEST_CASE("Core count change restarts the baseline") {
+        sys::CpuSampler sampler;
+        sampler.update(kStatBefore);
+        CHECK_FALSE(sampler.update("cpu  1100 0 500 8050 140 0 0 10\ncpu0 600 0 250 4000 50 0 0 0\n"));
+        CHECK_FALSE(sampler.isValid());
+        CHECK(sampler.getCoreCount() == 1);
+    }
+
+    TEST_CASE("Sampler re-reads the same descriptor") {
+        auto path = tempPath("liveops_proc_stat.txt");
+        std::ofstream(path) << kStatBefore;
+
+        sys::CpuSampler sampler(path, std::chrono::milliseconds(0));
+        CHECK_FALSE(sampler.sample());
+
+        std::ofstream(path, std::ios::trunc) << kStatAfter;
+        CHECK(sampler.sample());
+        CHECK(sampler.getTotal().total_pct == doctest::Approx(55.0));
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("ProcFile grows its buffer for large files") {
+        auto path = tempPath("liveops_proc_large.txt");
+        std::string content(3 * sys::ProcFile::kInitialBufferSize + 17, 'x');
+        std::ofstream(path) << content;
+
+        sys::ProcFile file(path);
+        CHECK(file.read() == content);
+        CHECK(file.read() == content);
+        CHECK(file.isOpen());
+
+        std::filesystem::remove(path);
+    }
+}
@@ -0,0 +1,106 @@
+#include <doctest/doctest.h>
+#include "../src/sys/DiskStats.h"
+#include <string>
+
+using namespace std::chrono_literals;
+
+namespace {
+// /proc/diskstats 한 줄 (merged 값은 계산에 쓰지 않으므로 0)
+std::string diskLine(uint32_t major, uint32_t minor, const char* name,
+                     uint64_t reads, uint64_t read_sectors, uint64_t read_ms,
+                     uint64_t writes, uint64_t write_sectors, uint64_t write_ms,
+                     uint64_t io_ms, uint64_t weighted_ms) {
+    return std::to_string(major) + " " + std::to_string(minor) + " " + name + " "
+         + std::to_string(reads) + " 0 " + std::to_string(read_sectors) + " " + std::to_string(read_ms) + " "
+         + std::to_string(writes) + " 0 " + std::to_string(write_sectors) + " " + std::to_string(write_ms) + " "
+         + "0 " + std::to_string(io_ms) + " " + std::to_string(weighted_ms) + " 0 0 0 0 0 0\n";
+}
+}
+
+TEST_SUITE("DiskStatsMonitor") {
+    TEST_CASE("Diskstats line is parsed") {
+        sys::ProcScanner scanner("   8       0 sda 1200 30 96000 800 5000 120 409600 4000 2 3000 4800 0 0 0 0\n");
+        uint32_t major = 0;
+        uint32_t minor = 0;
+        std::string_view name;
+        sys::DiskCounters counters;
+        REQUIRE(sys::DiskStatsMonitor::parseLine(scanner, major, minor, name, counters));
+        CHECK(major == 8);
+        CHECK(minor == 0);
+        CHECK(name == "sda");
+        CHECK(counters.reads == 1200);
+        CHECK(counters.read_sectors == 96000);
+        CHECK(counters.writes == 5000);
+        CHECK(counters.write_ms == 4000);
+        CHECK(counters.in_flight == 2);
+        CHECK(counters.weighted_ms == 4800);
+
+        sys::ProcScanner truncated("8 0 sda 1 2 3\n");
+        CHECK_FALSE(sys::DiskStatsMonitor::parseLine(truncated, major, minor, name, counters));
+
+        CHECK(sys::DiskStatsMonitor::isVirtual("loop3"));
+        CHECK(sys::DiskStatsMonitor::isVirtual("zram0"));
+        CHECK_FALSE(sys::DiskStatsMonitor::isVirtual("nvme0n1"));
+    }
+
+    TEST_CASE("Throughput, queue depth and await come from deltas") {
+        sys::DiskStatsMonitor monitor;
+        auto t0 = sys::DiskStatsMonitor::Clock::now();
+        CHECK_FALSE(monitor.update(diskLine(259, 0, "nvme0n1", 100, 800, 50, 200, 1600, 400, 100, 500)
+                                 + diskLine(7, 0, "loop0", 0, 0, 0, 0, 0, 0, 0, 0), t0));
+
+        // 2초 동안: 읽기 200회 / 8 MiB, 쓰기 600회 / 24 MiB, 요청 시간 합 1600ms, 바쁜 시간 1000ms
+        REQUIRE(monitor.update(diskLine(259, 0, "nvme0n1", 300, 800 + 16384, 450, 800, 1600 + 49152, 1600, 1100, 4500), t0 + 2s));
+
+        const auto* nvme = monitor.find(259, 0);
+        REQUIRE(nvme != nullptr);
+        CHECK(nvme->getName() == "nvme0n1");
+        CHECK(nvme->usage.read_mbps == doctest::Approx(4.0));
+        CHECK(nvme->usage.write_mbps == doctest::Approx(12.0));
+        CHECK(nvme->usage.read_iops == doctest::Approx(100.0));
+        CHECK(nvme->usage.write_iops == doctest::Approx(300.0));
+        CHECK(nvme->usage.await_ms == doctest::Approx(2.0));        // (400 + 1200) / 800
+        CHECK(nvme->usage.queue_depth == doctest::Approx(2.0));     // 4000ms / 2000ms
+        CHECK(nvme->usage.util_pct == doctest::Approx(50.0));
+
+        CHECK(monitor.find(7, 0) == nullptr);   // 가상 장치는 추적하지 않음
+    }
+
+    TEST_CASE("Busiest device is reported unless one is pinned") {
+        sys::DiskStatsMonitor monitor;
+        auto t0 = sys::DiskStatsMonitor::Clock::now();
+        monitor.update(diskLine(8, 0, "sda", 0, 0, 0, 0, 0, 0, 0, 0)
+                     + diskLine(8, 16, "sdb", 0, 0, 0, 0, 0, 0, 0, 0), t0);
+        REQUIRE(monitor.update(diskLine(8, 0, "sda", 0, 0, 0, 10, 80, 10, 100, 10)
+                             + diskLine(8, 16, "sdb", 0, 0, 0, 90, 720, 900, 800, 900), t0 + 1s));
+
+        REQUIRE(monitor.busiest() != nullptr);
+        CHECK(monitor.busiest()->getName() == "sdb");
+        REQUIRE(monitor.busiest("sda") != nullptr);
+        CHECK(monitor.busiest("sda")->usage.util_pct == doctest::Approx(10.0));
+        CHECK(monitor.busiest("sdz") == nullptr);
+
+        // 사라진 장치는 조회되지 않고, 다시 나타나면 기준값부터 시작
+        monitor.update(diskLine(8, 0, "sda", 0, 0, 0, 20, 160, 20, 200, 20), t0 + 2s);
+        CHECK(monitor.find(8, 16) == nullptr);
+        monitor.update(diskLine(8, 16, "sdb", 0, 0, 0, 1000, 8000, 9000, 900, 9000), t0 + 3s);
+        REQUIRE(monitor.find(8, 16) != nullptr);
+        CHECK(monitor.find(8, 16)->usage.write_iops == 0.0);
+    }
+
+    TEST_CASE("Many devices fit the table") {
+        sys::DiskStatsMonitor monitor;
+        std::string text;
+        for (uint32_t minor = 0; minor < 100; ++minor) {
+            text += diskLine(8, minor, "sdx", 0, 0, 0, 0, 0, 0, 0, 0);
+        }
+        auto t0 = sys::DiskStatsMonitor::Clock::now();
+        monitor.update(text, t0);
+        CHECK(monitor.update(text, t0 + 1s));
+
+        size_t count = 0;
+        monitor.forEach([&](const sys::DiskDevice&) { ++count; });
+        CHECK(count == 100);
+        CHECK(monitor.find(8, 99) != nullptr);
+    }
+}
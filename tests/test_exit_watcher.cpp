@@ -0,0 +1,119 @@
+#include <doctest/doctest.h>
+#include "../src/sys/ExitWatcher.h"
+#include "../src/sys/ProcessTracker.h"
+#include <csignal>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+// 이름을 바꾼 자식 프로세스 - 파이프에 한 바이트가 오면 종료한다
+struct Child {
+    pid_t pid{-1};
+    int release{-1};
+
+    explicit Child(const char* comm) {
+        int fds[2];
+        REQUIRE(pipe(fds) == 0);
+        pid = fork();
+        REQUIRE(pid >= 0);
+        if (pid == 0) {
+            prctl(PR_SET_NAME, comm);
+            close(fds[1]);
+            char byte;
+            (void)!read(fds[0], &byte, 1);
+            _exit(0);
+        }
+        close(fds[0]);
+        release = fds[1];
+    }
+    ~Child() {
+        if (release >= 0) close(release);
+        if (pid > 0) waitpid(pid, nullptr, 0);
+    }
+
+    void exit() {
+        (void)!write(release, "x", 1);
+    }
+};
+
+// prctl 이름 변경이 /proc에 보일 때까지 대기
+bool waitForComm(sys::ProcessTracker& tracker) {
+    for (int i = 0; i < 200; ++i) {
+        tracker.refresh(sys::ProcessTracker::Clock::now() + std::chrono::hours(i + 1));
+        if (tracker.getProcesses().front().running) return true;
+        usleep(5000);
+    }
+    return false;
+}
+}
+
+TEST_SUITE("ExitWatcher") {
+    TEST_CASE("Child exit is reported through its pidfd") {
+        sys::ExitWatcher watcher;
+        Child child("liveops_exit_a");
+        if (!watcher.watch(child.pid)) {
+            MESSAGE("pidfd_open 미지원 커널 - 건너뜀");
+            return;
+        }
+        CHECK(watcher.watch(child.pid));     // 중복 등록은 무시
+        CHECK(watcher.size() == 1);
+        CHECK(watcher.wait(20ms).empty());  // 아직 실행 중
+
+        auto started = std::chrono::steady_clock::now();
+        child.exit();
+        auto exited = watcher.wait(2000ms);
+        auto latency = std::chrono::steady_clock::now() - started;
+
+        REQUIRE(exited.size() == 1);
+        CHECK(exited[0] == child.pid);
+        CHECK(latency < 500ms);
+        CHECK(watcher.size() == 0);          // 보고한 pid는 감시에서 빠진다
+        CHECK(watcher.wait(10ms).empty());
+    }
+
+    TEST_CASE("Unwatched pid is not reported") {
+        sys::ExitWatcher watcher;
+        Child child("liveops_exit_b");
+        if (!watcher.watch(child.pid)) {
+            MESSAGE("pidfd_open 미지원 커널 - 건너뜀");
+            return;
+        }
+        watcher.unwatch(child.pid);
+        child.exit();
+        CHECK(watcher.wait(100ms).empty());
+        CHECK_FALSE(watcher.watch(-1));
+    }
+
+    TEST_CASE("Tracker detaches an exited process and rescans immediately") {
+        Child child("liveops_exit_c");
+        sys::ProcessTracker tracker;
+        tracker.setNames({"liveops_exit_c"});
+        REQUIRE(waitForComm(tracker));
+        CHECK(tracker.getProcesses().front().pid == child.pid);
+
+        if (!tracker.enableExitWatch()) {
+            MESSAGE("pidfd_open 미지원 커널 - 건너뜀");
+            return;
+        }
+        auto* watcher = tracker.getExitWatcher();
+        REQUIRE(watcher != nullptr);
+        CHECK(watcher->size() == 1);
+
+        uint64_t scans = tracker.getScanCount();
+        child.exit();
+        auto pids = watcher->wait(2000ms);
+        REQUIRE(pids.size() == 1);
+
+        auto exits = tracker.handleExits(pids);
+        REQUIRE(exits.size() == 1);
+        CHECK(exits[0].name == "liveops_exit_c");
+        CHECK(exits[0].pid == child.pid);
+        CHECK(exits[0].restarted_pid == 0);
+        CHECK(tracker.getScanCount() == scans + 1);   // 다음 refresh를 기다리지 않고 순회
+        CHECK_FALSE(tracker.getProcesses().front().running);
+        CHECK(tracker.takeLost().empty());            // pidfd 경로는 refresh 기록과 겹치지 않는다
+    }
+}
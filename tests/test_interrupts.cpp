@@ -0,0 +1,81 @@
+#include <doctest/doctest.h>
+#include "../src/sys/InterruptSampler.h"
+#include <string>
+
+using namespace std::chrono_literals;
+
+namespace {
+std::string statText(uint64_t ctxt, uint64_t intr, uint64_t softirq, uint64_t processes) {
+    return "cpu  10 0 10 100 0 0 0 0 0 0\n"
+           "cpu0 5 0 5 50 0 0 0 0 0 0\n"
+           "intr " + std::to_string(intr) + " 0 9 0 0 0 0 0 0 0 0 0\n"
+           "ctxt " + std::to_string(ctxt) + "\n"
+           "btime 1700000000\n"
+           "processes " + std::to_string(processes) + "\n"
+           "procs_running 2\n"
+           "procs_blocked 0\n"
+           "softirq " + std::to_string(softirq) + " 0 100 1 50 0 0 0 0 0 0\n";
+}
+
+std::string softirqsText(uint64_t rx0, uint64_t rx1, uint64_t rx2, uint64_t tx0) {
+    return "                    CPU0       CPU1       CPU2       \n"
+           "          HI:          0          0          0\n"
+           "       TIMER:     123456     123456     123456\n"
+           "      NET_TX: " + std::to_string(tx0) + " 0 0\n"
+           "      NET_RX: " + std::to_string(rx0) + " " + std::to_string(rx1) + " " + std::to_string(rx2) + "\n"
+           "         RCU:       4711       4711       4711\n";
+}
+}
+
+TEST_SUITE("InterruptSampler") {
+    TEST_CASE("Stat totals and per-CPU softirqs are parsed") {
+        sys::InterruptCounters counters;
+        REQUIRE(sys::InterruptSampler::parseStat(statText(1000, 500, 300, 42), counters));
+        CHECK(counters.ctxt == 1000);
+        CHECK(counters.intr == 500);
+        CHECK(counters.softirq == 300);
+        CHECK(counters.processes == 42);
+        CHECK_FALSE(sys::InterruptSampler::parseStat("cpu 1 2 3\n", counters));
+
+        sys::SoftirqCounters cores;
+        REQUIRE(sys::InterruptSampler::parseSoftirqs(softirqsText(10, 20, 30, 5), cores));
+        REQUIRE(cores.size() == 3);
+        CHECK(cores.net_rx[0] == 10);
+        CHECK(cores.net_rx[2] == 30);
+        CHECK(cores.net_tx[0] == 5);
+        CHECK_FALSE(sys::InterruptSampler::parseSoftirqs("garbage\n", cores));
+    }
+
+    TEST_CASE("Rates are per second and the NET_RX hot core is found") {
+        sys::InterruptSampler sampler("/nonexistent/stat", "/nonexistent/softirqs");
+        auto t0 = sys::InterruptSampler::Clock::now();
+        CHECK_FALSE(sampler.update(statText(1000, 500, 300, 10), softirqsText(100, 100, 100, 0), t0));
+
+        // 0.5초 동안 CPU1에 NET_RX 폭주
+        REQUIRE(sampler.update(statText(6000, 1500, 4300, 12), softirqsText(150, 3100, 200, 500), t0 + 500ms));
+        const auto& rates = sampler.getRates();
+        CHECK(rates.ctxt_per_s == doctest::Approx(10000.0));
+        CHECK(rates.intr_per_s == doctest::Approx(2000.0));
+        CHECK(rates.softirq_per_s == doctest::Approx(8000.0));
+        CHECK(rates.forks_per_s == doctest::Approx(4.0));
+        CHECK(rates.net_rx_per_s == doctest::Approx(6300.0));
+        CHECK(rates.net_tx_per_s == doctest::Approx(1000.0));
+        CHECK(rates.net_rx_max_core == 1);
+        CHECK(rates.net_rx_max_core_per_s == doctest::Approx(6000.0));
+
+        const auto& cores = sampler.getCores();
+        REQUIRE(cores.size() == 3);
+        CHECK(cores.net_rx_per_s[0] == doctest::Approx(100.0));
+        CHECK(cores.net_rx_share_pct[1] == doctest::Approx(6000.0 / 6300.0 * 100.0));
+    }
+
+    TEST_CASE("System totals survive a missing softirqs file") {
+        sys::InterruptSampler sampler("/nonexistent/stat", "/nonexistent/softirqs");
+        auto t0 = sys::InterruptSampler::Clock::now();
+        sampler.update(statText(0, 0, 0, 0), "", t0);
+        REQUIRE(sampler.update(statText(100, 0, 0, 0), "", t0 + 1s));
+        CHECK(sampler.getRates().ctxt_per_s == doctest::Approx(100.0));
+        CHECK(sampler.getCoreCount() == 0);
+        CHECK(sampler.getRates().net_rx_per_s == 0.0);
+    }
+}
@@ -0,0 +1,120 @@
+#include <doctest/doctest.h>
+#include "../src/core/LatencyHistogram.h"
+#include <algorithm>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+TEST_SUITE("LatencyHistogram") {
+    TEST_CASE("Bucket index round-trips within two significant digits") {
+        using H = core::LatencyHistogram;
+        CHECK(H::indexOf(0) == 0);
+        CHECK(H::indexOf(127) == 127);
+        CHECK(H::indexOf(128) == 128);
+        CHECK(H::indexOf(H::kMaxValueUs) == H::kCountsLength - 1);
+        for (uint64_t us : {1ull, 99ull, 128ull, 1000ull, 12345ull, 999999ull, 30000000ull}) {
+            size_t index = H::indexOf(us);
+            CHECK(H::lowestEquivalentUs(index) <= us);
+            CHECK(H::highestEquivalentUs(index) >= us);
+            // 128us 미만은 1us 단위, 그 위는 칸 너비 / 값 <= 1/64
+            uint64_t width = H::highestEquivalentUs(index) - H::lowestEquivalentUs(index) + 1;
+            CHECK(width <= std::max<uint64_t>(1, us / 64));
+        }
+    }
+
+    TEST_CASE("Percentiles of a uniform distribution") {
+        core::LatencyHistogram histogram;
+        for (int us = 1; us <= 10000; ++us) {
+            histogram.recordUs(us);
+        }
+        CHECK(histogram.getTotalCount() == 10000);
+        CHECK(histogram.getMinMs() == doctest::Approx(0.001));
+        CHECK(histogram.getMaxMs() == doctest::Approx(10.0));
+        auto p = histogram.getPercentiles();
+        CHECK(p.p50 == doctest::Approx(5.0).epsilon(0.02));
+        CHECK(p.p90 == doctest::Approx(9.0).epsilon(0.02));
+        CHECK(p.p99 == doctest::Approx(9.9).epsilon(0.02));
+        CHECK(p.p999 == doctest::Approx(9.99).epsilon(0.02));
+        CHECK(histogram.valueAtPercentile(99.0) == p.p99);
+        CHECK(histogram.valueAtPercentile(100.0) == doctest::Approx(10.0));
+
+        // 꼬리 하나가 p99.9만 끌어올린다
+        core::LatencyHistogram tail;
+        for (int i = 0; i < 999; ++i) tail.record(20.0);
+        tail.record(900.0);
+        auto t = tail.getPercentiles();
+        CHECK(t.p99 == doctest::Approx(20.0).epsilon(0.02));
+        CHECK(t.p999 == doctest::Approx(20.0).epsilon(0.02));
+        tail.record(900.0);
+        CHECK(tail.getPercentiles().p999 == doctest::Approx(900.0).epsilon(0.02));
+        tail.record(1e9);   // 범위 밖은 최대값 칸으로
+        CHECK(tail.getMaxMs() == doctest::Approx(core::LatencyHistogram::kMaxValueUs / 1000.0));
+    }
+
+    TEST_CASE("Merged interval snapshots equal one combined recording") {
+        core::LatencyHistogram first, second, combined;
+        for (int i = 0; i < 500; ++i) {
+            first.record(10.0 + i * 0.01);
+            combined.record(10.0 + i * 0.01);
+            second.record(80.0 + i * 0.1);
+            combined.record(80.0 + i * 0.1);
+        }
+        core::LatencyHistogram merged;
+        merged.add(first);
+        merged.add(second);
+        CHECK(merged.getTotalCount() == combined.getTotalCount());
+        CHECK(merged.getMinMs() == combined.getMinMs());
+        CHECK(merged.getMaxMs() == combined.getMaxMs());
+        CHECK(merged.getPercentiles().p50 == combined.getPercentiles().p50);
+        CHECK(merged.getPercentiles().p99 == combined.getPercentiles().p99);
+    }
+
+    TEST_CASE("Compact serialization round-trips") {
+        core::LatencyHistogram histogram;
+        for (int i = 0; i < 1000; ++i) histogram.record(25.0 + (i % 10));
+        histogram.record(450.0);
+
+        std::vector<uint8_t> bytes;
+        histogram.serialize(bytes);
+        // 고정 배열(5.4KB)이 아니라 채워진 칸 수에 비례
+        CHECK(bytes.size() < 64);
+
+        core::LatencyHistogram decoded;
+        REQUIRE(core::LatencyHistogram::deserialize(bytes.data(), bytes.size(), decoded));
+        CHECK(decoded.getTotalCount() == histogram.getTotalCount());
+        CHECK(decoded.getMinMs() == histogram.getMinMs());
+        CHECK(decoded.getMaxMs() == histogram.getMaxMs());
+        CHECK(decoded.getPercentiles().p999 == histogram.getPercentiles().p999);
+        CHECK_FALSE(histogram.encode().empty());
+
+        core::LatencyHistogram empty;
+        empty.serialize(bytes);
+        REQUIRE(core::LatencyHistogram::deserialize(bytes.data(), bytes.size(), decoded));
+        CHECK(decoded.getTotalCount() == 0);
+
+        bytes[0] = 99;   // 다른 버전
+        CHECK_FALSE(core::LatencyHistogram::deserialize(bytes.data(), bytes.size(), decoded));
+    }
+
+    TEST_CASE("Window drops intervals older than its slots") {
+        core::LatencyWindow window(10s);
+        auto start = core::LatencyWindow::Clock::now();
+        core::LatencyHistogram interval;
+        interval.record(100.0);
+        window.add(interval, start);
+
+        interval.reset();
+        interval.record(10.0);
+        window.add(interval, start + 15s);
+        CHECK(window.get().getTotalCount() == 2);
+
+        // 6개 구간(60초)이 지나면 첫 구간이 빠진다
+        interval.reset();
+        window.add(interval, start + 61s);
+        CHECK(window.get().getTotalCount() == 1);
+        CHECK(window.get().getMaxMs() == doctest::Approx(10.0).epsilon(0.02));
+
+        window.add(interval, start + 500s);
+        CHECK(window.get().getTotalCount() == 0);
+    }
+}
@@ -0,0 +1,145 @@
+#include <doctest/doctest.h>
+#include "../src/net/LinkStats.h"
+#include <arpa/inet.h>
+#include <cstring>
+#include <linux/if_link.h>
+#include <linux/rtnetlink.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+// 테스트용 netlink 메시지 조립기 (헤더 + 고정 본문 + 속성들)
+struct MessageBuilder {
+    std::vector<char> data;
+
+    MessageBuilder(uint16_t type, const void* body, size_t body_size) {
+        data.resize(NLMSG_SPACE(body_size));
+        auto* header = reinterpret_cast<nlmsghdr*>(data.data());
+        header->nlmsg_type = type;
+        std::memcpy(NLMSG_DATA(header), body, body_size);
+        header->nlmsg_len = static_cast<uint32_t>(NLMSG_LENGTH(body_size));
+    }
+
+    void attr(uint16_t type, const void* payload, size_t size) {
+        size_t offset = NLMSG_ALIGN(header()->nlmsg_len);
+        data.resize(offset + RTA_SPACE(size));
+        auto* rta = reinterpret_cast<rtattr*>(data.data() + offset);
+        rta->rta_type = type;
+        rta->rta_len = static_cast<unsigned short>(RTA_LENGTH(size));
+        std::memcpy(RTA_DATA(rta), payload, size);
+        header()->nlmsg_len = static_cast<uint32_t>(offset + RTA_SPACE(size));
+    }
+
+    nlmsghdr* header() { return reinterpret_cast<nlmsghdr*>(data.data()); }
+};
+}
+
+TEST_SUITE("LinkStats") {
+    TEST_CASE("RTM_NEWLINK with IFLA_STATS64 is parsed") {
+        ifinfomsg info{};
+        info.ifi_index = 7;
+        MessageBuilder message(RTM_NEWLINK, &info, sizeof(info));
+        message.attr(IFLA_IFNAME, "eth0", 5);
+        rtnl_link_stats64 stats{};
+        stats.rx_bytes = 5'000'000'000ULL;   // 32비트를 넘는 값
+        stats.tx_bytes = 123456;
+        stats.rx_packets = 10;
+        stats.tx_packets = 20;
+        stats.rx_errors = 1;
+        stats.tx_dropped = 3;
+        message.attr(IFLA_STATS64, &stats, sizeof(stats));
+
+        net::LinkInfo link;
+        REQUIRE(net::LinkMonitor::parseLink(message.header(), link));
+        CHECK(link.ifindex == 7);
+        CHECK(link.getName() == "eth0");
+        CHECK(link.counters.rx_bytes == 5'000'000'000ULL);
+        CHECK(link.counters.tx_bytes == 123456);
+        CHECK(link.counters.tx_packets == 20);
+        CHECK(link.counters.rx_errors == 1);
+        CHECK(link.counters.tx_dropped == 3);
+
+        MessageBuilder route_message(RTM_NEWROUTE, &info, sizeof(info));
+        CHECK_FALSE(net::LinkMonitor::parseLink(route_message.header(), link));
+    }
+
+    TEST_CASE("Only main-table default routes are picked") {
+        rtmsg route{};
+        route.rtm_family = AF_INET;
+        route.rtm_table = RT_TABLE_MAIN;
+        route.rtm_type = RTN_UNICAST;
+        MessageBuilder message(RTM_NEWROUTE, &route, sizeof(route));
+        int oif = 3;
+        uint32_t priority = 600;
+        message.attr(RTA_OIF, &oif, sizeof(oif));
+        message.attr(RTA_PRIORITY, &priority, sizeof(priority));
+
+        int ifindex = 0;
+        uint32_t metric = 0;
+        REQUIRE(net::LinkMonitor::parseRoute(message.header(), ifindex, metric));
+        CHECK(ifindex == 3);
+        CHECK(metric == 600);
+
+        // 10.0.0.0/8 같은 일반 경로는 제외
+        route.rtm_dst_len = 8;
+        MessageBuilder subnet(RTM_NEWROUTE, &route, sizeof(route));
+        subnet.attr(RTA_OIF, &oif, sizeof(oif));
+        CHECK_FALSE(net::LinkMonitor::parseRoute(subnet.header(), ifindex, metric));
+
+        // 정책 라우팅 테이블의 기본 경로도 제외
+        route.rtm_dst_len = 0;
+        route.rtm_table = RT_TABLE_LOCAL;
+        MessageBuilder local(RTM_NEWROUTE, &route, sizeof(route));
+        local.attr(RTA_OIF, &oif, sizeof(oif));
+        CHECK_FALSE(net::LinkMonitor::parseRoute(local.header(), ifindex, metric));
+    }
+
+    TEST_CASE("Loopback rates follow real traffic") {
+        net::LinkMonitor monitor("lo");
+        auto start = net::LinkMonitor::Clock::now();
+        REQUIRE(monitor.sample(start));
+        REQUIRE(monitor.getActive() != nullptr);
+        CHECK(monitor.getActive()->ifindex == static_cast<int>(if_nametoindex("lo")));
+        CHECK(monitor.getRates().tx_kbps == 0.0);   // 첫 샘플은 기준값
+
+        // 127.0.0.1로 1000 x 1000바이트 전송
+        int fd = socket(AF_INET, SOCK_DGRAM, 0);
+        REQUIRE(fd >= 0);
+        sockaddr_in target{};
+        target.sin_family = AF_INET;
+        target.sin_port = htons(9);
+        target.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        char payload[1000] = {};
+        for (int i = 0; i < 1000; ++i) {
+            sendto(fd, payload, sizeof(payload), 0, reinterpret_cast<sockaddr*>(&target), sizeof(target));
+        }
+        close(fd);
+
+        REQUIRE(monitor.sample(start + 1s));
+        const auto& rates = monitor.getRates();
+        CHECK(rates.tx_kbps >= 1000 * 1000 * 8 / 1000.0);
+        CHECK(rates.tx_pps >= 1000);
+        CHECK(rates.rx_pps >= 1000);
+
+        monitor.setInterface("liveops-missing0");
+        CHECK_FALSE(monitor.sample(start + 2s));
+        CHECK(monitor.getActive() == nullptr);
+    }
+
+    TEST_CASE("Default route interface is discovered") {
+        net::LinkMonitor monitor;
+        int ifindex = monitor.findDefaultRoute();
+        if (ifindex == 0) {
+            MESSAGE("기본 경로 없음 - 건너뜀");
+            return;
+        }
+        REQUIRE(monitor.sample());
+        REQUIRE(monitor.getActive() != nullptr);
+        CHECK(monitor.getActive()->ifindex == ifindex);
+    }
+}
@@ -0,0 +1,72 @@
+#include <doctest/doctest.h>
+#include "../src/net/LossWindow.h"
+
+using Arrival = net::LossWindow::Arrival;
+
+TEST_SUITE("LossWindow") {
+    TEST_CASE("Only settled sequences count toward loss") {
+        net::LossWindow window;
+        for (uint32_t seq = 1; seq <= 4; ++seq) window.sent(seq);
+        CHECK(window.received(1) == Arrival::Fresh);
+        CHECK(window.received(2) == Arrival::Fresh);
+        CHECK(window.getStats().window == 0);   // 아직 대기 중
+
+        window.settle();
+        auto stats = window.getStats();
+        CHECK(stats.window == 4);
+        CHECK(stats.lost == 2);
+        CHECK(stats.loss_pct == doctest::Approx(50.0));
+        CHECK(stats.max_burst == 2);
+        CHECK(stats.longest_burst == 2);
+    }
+
+    TEST_CASE("Reordered, duplicate and late arrivals are classified") {
+        net::LossWindow window;
+        for (uint32_t seq = 1; seq <= 3; ++seq) window.sent(seq);
+        CHECK(window.received(3) == Arrival::Fresh);
+        CHECK(window.received(1) == Arrival::Reordered);
+        CHECK(window.received(1) == Arrival::Duplicate);
+        CHECK(window.received(9) == Arrival::Unknown);
+        window.settle();
+        CHECK(window.getStats().lost == 1);
+
+        // 확정 뒤 도착 - 창에서는 손실이 아니게 되지만 late로 남는다
+        CHECK(window.received(2) == Arrival::Late);
+        auto stats = window.getStats();
+        CHECK(stats.lost == 0);
+        CHECK(stats.reordered == 1);
+        CHECK(stats.duplicates == 1);
+        CHECK(stats.late == 1);
+        CHECK(stats.longest_burst == 1);   // 확정 시점 기준 기록은 유지
+    }
+
+    TEST_CASE("Window slides and bursts span rounds") {
+        net::LossWindow window;
+        uint32_t seq = 0;
+        // 300발 중 100~109만 손실 (라운드마다 4발씩 확정)
+        while (seq < 300) {
+            for (int k = 0; k < 4; ++k) {
+                window.sent(++seq);
+                if (seq < 100 || seq > 109) window.received(seq);
+            }
+            window.settle();
+        }
+        auto stats = window.getStats();
+        CHECK(stats.window == net::LossWindow::kSize);
+        CHECK(stats.lost == 10);   // 45~300 창 안에 100~109 포함
+        CHECK(stats.max_burst == 10);
+        CHECK(stats.longest_burst == 10);
+
+        // 창 밖으로 밀려나면 손실에서 빠진다
+        for (int k = 0; k < 100; ++k) {
+            window.sent(++seq);
+            window.received(seq);
+        }
+        window.settle();
+        stats = window.getStats();
+        CHECK(stats.lost == 0);
+        CHECK(stats.max_burst == 0);
+        CHECK(stats.longest_burst == 10);
+        CHECK(window.received(5) == Arrival::Late);
+    }
+}
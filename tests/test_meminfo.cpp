@@ -0,0 +1,41 @@
+#include <doctest/doctest.h>
+#include "../src/sys/MemInfo.h"
+
+TEST_SUITE("MemInfo") {
+    TEST_CASE("Meminfo keys are read in place") {
+        sys::MemInfo info;
+        REQUIRE(sys::MemInfoReader::parse(
+            "MemTotal:       16318480 kB\n"
+            "MemFree:         1203344 kB\n"
+            "MemAvailable:    9876543 kB\n"
+            "Buffers:          345678 kB\n"
+            "Cached:          7654321 kB\n"
+            "SwapCached:            0 kB\n"
+            "Active:          5000000 kB\n", info));
+        CHECK(info.total_kb == 16318480);
+        CHECK(info.free_kb == 1203344);
+        CHECK(info.available_kb == 9876543);
+        CHECK(info.buffers_kb == 345678);
+        CHECK(info.cached_kb == 7654321);   // SwapCached와 섞이지 않는다
+        CHECK(info.usedKb() == 16318480 - 9876543);
+    }
+
+    TEST_CASE("Old kernels without MemAvailable get an estimate") {
+        sys::MemInfo info;
+        REQUIRE(sys::MemInfoReader::parse(
+            "MemTotal: 1000 kB\nMemFree: 100 kB\nBuffers: 50 kB\nCached: 200 kB\n", info));
+        CHECK(info.available_kb == 350);
+        CHECK_FALSE(sys::MemInfoReader::parse("MemFree: 100 kB\n", info));
+        CHECK_FALSE(sys::MemInfoReader::parse("", info));
+    }
+
+    TEST_CASE("Live /proc/meminfo is readable repeatedly") {
+        sys::MemInfoReader reader;
+        sys::MemInfo first;
+        sys::MemInfo second;
+        REQUIRE(reader.read(first));
+        REQUIRE(reader.read(second));
+        CHECK(first.total_kb == second.total_kb);
+        CHECK(second.available_kb <= second.total_kb);
+    }
+}
@@ -0,0 +1,89 @@
+#include <doctest/doctest.h>
+#include "../src/core/MetricRegistry.h"
+#include "../src/core/Collector.h"
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+TEST_SUITE("MetricRegistry") {
+    TEST_CASE("Keys resolve to their slots at compile time and at runtime") {
+        static_assert(core::metricId("rtt_ms") == core::MetricId::RttMs);
+        static_assert(core::metricKey(core::MetricId::MemMb) == "mem_mb");
+
+        core::MetricId id{};
+        CHECK(core::findMetric("uplink_kbps", id));
+        CHECK(id == core::MetricId::UplinkKbps);
+        CHECK_FALSE(core::findMetric("memory_mb", id));  // 오타는 0이 아니라 조회 실패
+    }
+
+    TEST_CASE("Source masks partition the registry") {
+        core::MetricMask combined = 0;
+        for (auto source : {core::MetricSource::System, core::MetricSource::Disk,
+                            core::MetricSource::Network, core::MetricSource::Runtime,
+                            core::MetricSource::Pressure, core::MetricSource::Cgroup,
+                            core::MetricSource::Interrupt}) {
+            auto mask = core::sourceMask(source);
+            CHECK((combined & mask) == 0);
+            combined |= mask;
+        }
+        CHECK(combined == core::kAllMetrics);
+        CHECK(core::sourceMask(core::MetricSource::Network) ==
+              core::metricMask({core::MetricId::RttMs, core::MetricId::RttMinMs, core::MetricId::RttUserMs,
+                                core::MetricId::RttKernelMs, core::MetricId::RttHostDelayMs, core::MetricId::JitterMs,
+                                core::MetricId::RttP50Ms, core::MetricId::RttP90Ms, core::MetricId::RttP99Ms,
+                                core::MetricId::RttP999Ms, core::MetricId::LossPct, core::MetricId::LossBurst,
+                                core::MetricId::UplinkKbps,
+                                core::MetricId::NetRxKbps, core::MetricId::NetTxPps, core::MetricId::NetRxPps,
+                                core::MetricId::NetErrorsPerSec, core::MetricId::NetDropsPerSec}));
+    }
+
+    TEST_CASE("Aggregator merges only the slots each source owns") {
+        auto origin = std::chrono::steady_clock::now();
+        core::Collector system("system", 10ms, [](core::SourceSample& sample) {
+            sample.metrics[core::MetricId::CpuPct] = 42.0;
+            sample.metrics[core::MetricId::RttMs] = 999.0;  // 소유하지 않은 슬롯
+        }, origin);
+        core::Collector network("network", 10ms, [](core::SourceSample& sample) {
+            sample.metrics[core::MetricId::RttMs] = 12.5;
+        }, origin);
+
+        core::Aggregator aggregator;
+        aggregator.addSource(system, core::sourceMask(core::MetricSource::System));
+        aggregator.addSource(network, core::sourceMask(core::MetricSource::Network));
+
+        system.start();
+        network.start();
+        std::this_thread::sleep_for(50ms);
+        system.stop();
+        network.stop();
+
+        aggregator.join(std::chrono::steady_clock::now());
+        core::MetricFrame frame;
+        frame[core::MetricId::TickLateMs] = 1.0;
+        aggregator.merge(frame);
+
+        CHECK(frame[core::MetricId::CpuPct] == doctest::Approx(42.0));
+        CHECK(frame[core::MetricId::RttMs] == doctest::Approx(12.5));
+        CHECK(frame[core::MetricId::TickLateMs] == doctest::Approx(1.0));
+    }
+
+    TEST_CASE("Core arrays follow the source that owns them") {
+        core::MetricFrame system;
+        system.cores.count = 2;
+        system.cores.busy = {100, 50};
+        system.cores.net_rx = {7, 7};       // system 소스는 net_rx를 채우지 않는다
+
+        core::MetricFrame irq;
+        irq.cores.count = 0;
+        irq.cores.net_rx = {180, 20};
+
+        core::MetricFrame frame;
+        frame.copyFrom(system, core::sourceMask(core::MetricSource::System));
+        frame.copyFrom(irq, core::sourceMask(core::MetricSource::Interrupt));
+        CHECK(frame.cores.count == 2);
+        CHECK(frame.cores.busy[0] == 100);
+        CHECK(frame.cores.net_rx[0] == 180);
+        CHECK(frame.cores.net_rx[1] == 20);
+    }
+}
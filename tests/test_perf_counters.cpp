@@ -0,0 +1,72 @@
+#include <doctest/doctest.h>
+#include "../src/sys/PerfCounters.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+TEST_SUITE("PerfCounters") {
+    TEST_CASE("Group read returns all software counters at once") {
+        sys::PerfGroup group(getpid());
+        if (!group.isOpen()) {
+            MESSAGE("perf_event_open 불가 (perf_event_paranoid/seccomp) - 건너뜀");
+            return;
+        }
+
+        sys::PerfSample before;
+        REQUIRE(group.read(before));
+
+        // 연 뒤에 만든 스레드도 inherit로 센다 - 잠들었다 깨며 문맥 전환, 새 메모리로 페이지 폴트
+        std::thread worker([]() {
+            volatile uint64_t sum = 0;
+            for (int i = 0; i < 20; ++i) {
+                for (int j = 0; j < 200000; ++j) sum = sum + static_cast<uint64_t>(j);
+                usleep(1000);
+            }
+            std::vector<char> pages(4 << 20, 1);
+            sum = sum + static_cast<uint64_t>(pages[pages.size() / 2]);
+        });
+        worker.join();
+
+        sys::PerfSample after;
+        REQUIRE(group.read(after));
+        CHECK(after.task_clock_ns > before.task_clock_ns);
+        CHECK(after.context_switches >= before.context_switches + 10);
+        CHECK(after.page_faults > before.page_faults);
+        CHECK(after.cpu_migrations >= before.cpu_migrations);
+        CHECK(after.time_enabled >= after.time_running);
+    }
+
+    TEST_CASE("Threads running before the group was opened are counted") {
+        // inherit는 연 뒤의 스레드만 세므로 먼저 떠 있던 스레드는 TID별 그룹으로 잡아야 한다
+        std::atomic<bool> go{false};
+        std::thread worker([&go]() {
+            while (!go.load()) usleep(1000);
+            for (int i = 0; i < 20; ++i) usleep(1000);
+        });
+
+        sys::PerfGroup group(getpid());
+        if (!group.isOpen()) {
+            go = true;
+            worker.join();
+            MESSAGE("perf_event_open 불가 (perf_event_paranoid/seccomp) - 건너뜀");
+            return;
+        }
+
+        sys::PerfSample before;
+        REQUIRE(group.read(before));
+        go = true;
+        worker.join();
+
+        sys::PerfSample after;
+        REQUIRE(group.read(after));
+        CHECK(after.context_switches >= before.context_switches + 15);
+    }
+
+    TEST_CASE("Missing process cannot be opened") {
+        sys::PerfGroup group(0x3ffffff);   // pid_max 밖
+        CHECK_FALSE(group.isOpen());
+        sys::PerfSample sample;
+        CHECK_FALSE(group.read(sample));
+    }
+}
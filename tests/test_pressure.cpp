@@ -0,0 +1,102 @@
+#include <doctest/doctest.h>
+#include "../src/sys/PressureMonitor.h"
+#include "TempTree.h"
+#include <chrono>
+#include <filesystem>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace {
+const char* kCpuPressure =
+    "some avg10=12.56 avg60=39.18 avg300=23.17 total=347018389\n"
+    "full avg10=0.00 avg60=0.00 avg300=0.00 total=0\n";
+
+// 임시 디렉터리에 /proc/pressure 모양의 파일 생성
+struct FakePressureDir {
+    test::TempTree tree;
+    fs::path root;
+
+    explicit FakePressureDir(const char* name) : tree(name), root(tree.root()) {
+        tree.mkdir("proc");
+        tree.mkdir("cgroup");
+    }
+
+    void write(const fs::path& path, const std::string& text) { tree.write(path, text); }
+
+    static std::string line(const char* kind, double avg10, uint64_t total) {
+        return std::string(kind) + " avg10=" + std::to_string(avg10) + " avg60=0.00 avg300=0.00 total="
+             + std::to_string(total) + "\n";
+    }
+};
+}
+
+TEST_SUITE("PressureMonitor") {
+    TEST_CASE("Pressure file is parsed") {
+        sys::PressureStat stat;
+        REQUIRE(sys::PressureMonitor::parse(kCpuPressure, stat));
+        CHECK(stat.some.avg10 == doctest::Approx(12.56));
+        CHECK(stat.some.avg60 == doctest::Approx(39.18));
+        CHECK(stat.some.avg300 == doctest::Approx(23.17));
+        CHECK(stat.some.total_us == 347018389);
+        CHECK(stat.full.total_us == 0);
+
+        // 오래된 커널의 cpu 파일은 some 줄만 있다
+        sys::PressureStat some_only;
+        CHECK(sys::PressureMonitor::parse("some avg10=1.50 avg60=0.10 avg300=0.01 total=42\n", some_only));
+        CHECK(some_only.some.total_us == 42);
+
+        sys::PressureStat broken;
+        CHECK_FALSE(sys::PressureMonitor::parse("", broken));
+        CHECK_FALSE(sys::PressureMonitor::parse("some avg10=x\n", broken));
+    }
+
+    TEST_CASE("Stall totals are reported as deltas") {
+        FakePressureDir dir("liveops_psi_delta");
+        dir.write("proc/cpu", FakePressureDir::line("some", 5.0, 1000) + FakePressureDir::line("full", 0.0, 10));
+        dir.write("proc/memory", FakePressureDir::line("some", 0.0, 0) + FakePressureDir::line("full", 0.0, 0));
+
+        sys::PressureMonitor monitor((dir.root / "proc").string());
+        REQUIRE(monitor.sample());
+        CHECK(monitor.isAvailable(sys::PressureResource::Cpu));
+        CHECK(monitor.isAvailable(sys::PressureResource::Memory));
+        CHECK_FALSE(monitor.isAvailable(sys::PressureResource::Io));   // 파일 없음
+        CHECK(monitor.get(sys::PressureResource::Cpu).some_stall_us == 0);  // 첫 샘플은 기준값
+
+        dir.write("proc/cpu", FakePressureDir::line("some", 7.5, 251000) + FakePressureDir::line("full", 1.0, 5010));
+        REQUIRE(monitor.sample());
+        const auto& cpu = monitor.get(sys::PressureResource::Cpu);
+        CHECK(cpu.some_avg10 == doctest::Approx(7.5));
+        CHECK(cpu.full_avg10 == doctest::Approx(1.0));
+        CHECK(cpu.some_stall_us == 250000);
+        CHECK(cpu.full_stall_us == 5000);
+
+        // 누적값이 줄면(cgroup 재생성) 0으로 취급
+        dir.write("proc/cpu", FakePressureDir::line("some", 0.0, 10) + FakePressureDir::line("full", 0.0, 0));
+        REQUIRE(monitor.sample());
+        CHECK(monitor.get(sys::PressureResource::Cpu).some_stall_us == 0);
+    }
+
+    TEST_CASE("Cgroup pressure files take precedence when present") {
+        FakePressureDir dir("liveops_psi_cgroup");
+        dir.write("proc/cpu", FakePressureDir::line("some", 1.0, 100));
+        dir.write("proc/io", FakePressureDir::line("some", 2.0, 200));
+        dir.write("cgroup/cpu.pressure", FakePressureDir::line("some", 50.0, 5000));
+
+        sys::PressureMonitor monitor((dir.root / "proc").string(), (dir.root / "cgroup").string());
+        REQUIRE(monitor.sample());
+        CHECK(monitor.getPath(sys::PressureResource::Cpu) == (dir.root / "cgroup" / "cpu.pressure").string());
+        CHECK(monitor.get(sys::PressureResource::Cpu).some_avg10 == doctest::Approx(50.0));
+        CHECK(monitor.getPath(sys::PressureResource::Io) == (dir.root / "proc" / "io").string());
+        CHECK(monitor.get(sys::PressureResource::Io).some_avg10 == doctest::Approx(2.0));
+    }
+
+    TEST_CASE("Waiting without triggers sleeps for the timeout") {
+        // 트리거가 모두 해제된 뒤에도 감시 루프가 바쁘게 돌지 않아야 한다
+        sys::PressureTriggers triggers;
+        REQUIRE(triggers.size() == 0);
+        auto start = std::chrono::steady_clock::now();
+        CHECK(triggers.wait(std::chrono::milliseconds(50)).empty());
+        CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(45));
+    }
+}
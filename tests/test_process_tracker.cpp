@@ -0,0 +1,197 @@
+#include <doctest/doctest.h>
+#include "../src/sys/ProcessTracker.h"
+#include "TempTree.h"
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+using namespace std::chrono_literals;
+
+namespace {
+// 임시 디렉터리에 /proc/<pid>/stat 모양의 트리 생성
+struct FakeProc {
+    test::TempTree tree;
+    fs::path root;
+
+    explicit FakeProc(const char* name) : tree(name), root(tree.root()) {
+        tree.mkdir("self");
+    }
+
+    void process(int pid, const std::string& comm, uint64_t start_time, char state = 'S',
+                 uint64_t utime = 250, uint64_t stime = 50, uint64_t threads = 12, uint64_t rss = 2000) {
+        tree.mkdir(std::to_string(pid));
+        std::ofstream(root / std::to_string(pid) / "stat", std::ios::trunc)
+            << pid << " (" << comm << ") " << state << " 1 " << pid << " " << pid
+            << " 0 -1 4194560 1000 0 0 0 " << utime << " " << stime << " 0 0 20 0 " << threads << " 0 "
+            << start_time << " 1000000 " << rss << " 18446744073709551615\n";
+    }
+
+    void io(int pid, uint64_t read_bytes, uint64_t write_bytes, uint64_t syscr, uint64_t syscw,
+            uint64_t cancelled = 0) {
+        std::ofstream(root / std::to_string(pid) / "io", std::ios::trunc)
+            << "rchar: " << read_bytes * 2 << "\nwchar: " << write_bytes * 2 << "\nsyscr: " << syscr
+            << "\nsyscw: " << syscw << "\nread_bytes: " << read_bytes << "\nwrite_bytes: " << write_bytes
+            << "\ncancelled_write_bytes: " << cancelled << "\n";
+    }
+};
+}
+
+TEST_SUITE("ProcessTracker") {
+    TEST_CASE("Matcher finds every registered name in one pass") {
+        sys::NameMatcher matcher;
+        matcher.compile({"obs64", "obs", "ffmpeg"});
+        CHECK(matcher.match("obs64") == 0b011);
+        CHECK(matcher.match("obs-ffmpeg-mux") == 0b110);
+        CHECK(matcher.match("bash") == 0);
+        CHECK(matcher.match("obs64", 0b001) == 0b001);   // 후보 제한
+        CHECK(matcher.allMask() == 0b111);
+    }
+
+    TEST_CASE("Names prefixed with = match the whole comm only") {
+        sys::NameMatcher matcher;
+        matcher.compile({"=obs", "ffmpeg"});
+        CHECK(matcher.match("obs") == 0b01);
+        CHECK(matcher.match("obs-ffmpeg-mux") == 0b10);
+        CHECK(matcher.match("obs-browser-page") == 0);
+        CHECK(matcher.match("obs", 0b10) == 0);            // 후보 제한
+        CHECK(matcher.allMask() == 0b11);
+    }
+
+    TEST_CASE("Stat line with odd comm is parsed") {
+        std::string_view comm;
+        sys::ProcStat stat;
+        REQUIRE(sys::ProcessTracker::parseStat(
+            "4242 (obs (main) 2) R 1 4242 4242 0 -1 4194560 1 0 0 0 250 50 0 0 20 0 12 0 987654 1 2 3\n", comm, stat));
+        CHECK(comm == "obs (main) 2");
+        CHECK(stat.state == 'R');
+        CHECK(stat.utime == 250);
+        CHECK(stat.stime == 50);
+        CHECK(stat.threads == 12);
+        CHECK(stat.start_time == 987654);
+        CHECK(stat.rss_pages == 2);
+        CHECK_FALSE(sys::ProcessTracker::parseStat("4242 (obs) R 1 2\n", comm, stat));
+    }
+
+    TEST_CASE("Cached PIDs avoid rescans until they disappear") {
+        FakeProc proc("liveops_proc_cache");
+        proc.process(100, "bash", 10);
+        proc.process(200, "obs64", 20);
+        proc.process(300, "obs32", 30);
+
+        sys::ProcessTracker tracker(proc.root.string(), 1h);
+        tracker.setNames({"obs64", "obs32"});
+        auto now = sys::ProcessTracker::Clock::now();
+        CHECK(tracker.refresh(now));
+        REQUIRE(tracker.getProcesses().size() == 2);
+        CHECK(tracker.getProcesses()[0].pid == 200);
+        CHECK(tracker.getProcesses()[1].pid == 300);
+        CHECK(tracker.getScanCount() == 1);
+
+        // 모두 살아 있으면 순회 없음
+        for (int i = 0; i < 10; ++i) {
+            CHECK_FALSE(tracker.refresh(now + std::chrono::seconds(i)));
+        }
+        CHECK(tracker.getScanCount() == 1);
+
+        // PID 재사용 (시작 시각 변경) - 즉시 다시 찾는다
+        proc.process(200, "other", 99);
+        proc.process(210, "obs64", 40);
+        CHECK(tracker.refresh(now + 20s));
+        CHECK(tracker.getProcesses()[0].pid == 210);
+        CHECK(tracker.getProcesses()[0].start_time == 40);
+        CHECK(tracker.getScanCount() == 2);
+
+        // 좀비가 되면 사라진 것으로 본다
+        proc.process(300, "obs32", 30, 'Z');
+        CHECK(tracker.refresh(now + 30s));
+        CHECK_FALSE(tracker.getProcesses()[1].running);
+    }
+
+    TEST_CASE("Missing names are retried at the rescan interval") {
+        FakeProc proc("liveops_proc_retry");
+        proc.process(100, "bash", 10);
+
+        sys::ProcessTracker tracker(proc.root.string(), 2s);
+        tracker.setNames({"obs64"});
+        auto now = sys::ProcessTracker::Clock::now();
+        CHECK(tracker.refresh(now));
+        CHECK_FALSE(tracker.getProcesses()[0].running);
+
+        proc.process(500, "obs64", 50);
+        CHECK_FALSE(tracker.refresh(now + 1s));       // 아직 주기 전
+        CHECK(tracker.refresh(now + 2s));
+        CHECK(tracker.getProcesses()[0].running);
+        CHECK(tracker.getProcesses()[0].pid == 500);
+    }
+
+    TEST_CASE("CPU share, RSS and threads come from stat deltas") {
+        FakeProc proc("liveops_proc_usage");
+        proc.process(200, "obs64", 20, 'S', 250, 50, 12, 2000);
+
+        sys::ProcessTracker tracker(proc.root.string(), 1h);
+        tracker.setNames({"obs64"});
+        auto now = sys::ProcessTracker::Clock::now();
+        tracker.refresh(now);
+        const auto& obs = tracker.getProcesses()[0];
+        CHECK(obs.cpu_pct == 0.0);   // 첫 샘플은 기준값
+        CHECK(obs.rss_bytes == 2000 * static_cast<uint64_t>(sysconf(_SC_PAGESIZE)));
+        CHECK(obs.threads == 12);
+
+        // 2초 동안 utime+stime이 3초 분량 증가 = 1.5코어
+        double ticks = static_cast<double>(sysconf(_SC_CLK_TCK));
+        auto delta = static_cast<uint64_t>(3 * ticks);
+        proc.process(200, "obs64", 20, 'R', 250 + delta * 2 / 3, 50 + delta / 3, 40, 3000);
+        CHECK_FALSE(tracker.refresh(now + 2s));
+        CHECK(obs.cpu_cores == doctest::Approx(1.5));
+        CHECK(obs.cpu_pct == doctest::Approx(150.0 / static_cast<double>(sysconf(_SC_NPROCESSORS_ONLN))));
+        CHECK(obs.threads == 40);
+        CHECK(obs.rss_bytes == 3000 * static_cast<uint64_t>(sysconf(_SC_PAGESIZE)));
+    }
+
+    TEST_CASE("I/O rates come from /proc/<pid>/io deltas") {
+        sys::ProcIo io;
+        CHECK(sys::ProcessTracker::parseIo(
+            "rchar: 10\nwchar: 20\nsyscr: 3\nsyscw: 4\nread_bytes: 4096\nwrite_bytes: 8192\n"
+            "cancelled_write_bytes: 512\n", io));
+        CHECK(io.syscr == 3);
+        CHECK(io.syscw == 4);
+        CHECK(io.read_bytes == 4096);
+        CHECK(io.write_bytes == 8192);
+        CHECK(io.cancelled_write_bytes == 512);
+        CHECK_FALSE(sys::ProcessTracker::parseIo("rchar: 10\n", io));
+
+        FakeProc proc("liveops_proc_io");
+        proc.process(200, "obs64", 20);
+        proc.io(200, 1000, 5000, 10, 20);
+
+        sys::ProcessTracker tracker(proc.root.string(), 1h);
+        tracker.setNames({"obs64"});
+        auto now = sys::ProcessTracker::Clock::now();
+        tracker.refresh(now);
+        const auto& obs = tracker.getProcesses()[0];
+        CHECK(obs.io_active);
+        CHECK(obs.write_bytes_per_sec == 0.0);   // 첫 샘플은 기준값
+
+        // 2초 동안 녹화 파일에 8MB 기록
+        proc.io(200, 3000, 5000 + 8'000'000, 14, 220, 4096);
+        tracker.refresh(now + 2s);
+        CHECK(obs.read_bytes_per_sec == doctest::Approx(1000.0));
+        CHECK(obs.write_bytes_per_sec == doctest::Approx(4'000'000.0));
+        CHECK(obs.read_syscalls_per_sec == doctest::Approx(2.0));
+        CHECK(obs.write_syscalls_per_sec == doctest::Approx(100.0));
+        CHECK(obs.cancelled_write_bytes == 4096);
+
+        // 쓰기가 멈추면 0
+        tracker.refresh(now + 3s);
+        CHECK(obs.write_bytes_per_sec == 0.0);
+
+        // 다른 사용자 프로세스처럼 io를 읽을 수 없으면 비활성으로 표시
+        proc.process(300, "obs32", 30);
+        tracker.setNames({"obs32"});
+        tracker.refresh(now + 4s);
+        CHECK(tracker.getProcesses()[0].running);
+        CHECK_FALSE(tracker.getProcesses()[0].io_active);
+    }
+}
@@ -0,0 +1,56 @@
+#include <doctest/doctest.h>
+#include "../src/sys/RecordingStall.h"
+#include <chrono>
+
+using namespace std::chrono_literals;
+using Clock = sys::RecordingStallDetector::Clock;
+
+TEST_SUITE("RecordingStall") {
+    TEST_CASE("Stall is reported once after the threshold elapses") {
+        sys::RecordingStallDetector detector(3s);
+        auto start = Clock::now();
+
+        CHECK_FALSE(detector.update(true, true, 0.0, start));
+        CHECK_FALSE(detector.update(true, true, 0.0, start + 2900ms));
+        CHECK(detector.update(true, true, 0.0, start + 3s));
+        CHECK(detector.stalledFor(start + 3s) == 3s);
+        // 정체가 이어져도 다시 알리지 않는다
+        CHECK_FALSE(detector.update(true, true, 0.0, start + 10s));
+    }
+
+    TEST_CASE("Threshold depends on elapsed time, not on call count") {
+        // 100ms마다 불러도 1초마다 불러도 같은 시점에 알린다
+        for (auto period : {100ms, 1000ms}) {
+            sys::RecordingStallDetector detector(3s);
+            auto start = Clock::now();
+            auto fired = Clock::duration::zero();
+            for (auto elapsed = Clock::duration::zero(); elapsed <= 5s; elapsed += period) {
+                if (detector.update(true, true, 0.0, start + elapsed)) {
+                    fired = elapsed;
+                }
+            }
+            CHECK(fired == 3s);
+        }
+    }
+
+    TEST_CASE("Writes, stopped recording or unreadable io reset the stall") {
+        sys::RecordingStallDetector detector(3s);
+        auto start = Clock::now();
+
+        CHECK_FALSE(detector.update(true, true, 0.0, start));
+        CHECK_FALSE(detector.update(true, true, 4096.0, start + 2s));
+        CHECK(detector.stalledFor(start + 2s) == Clock::duration::zero());
+        CHECK_FALSE(detector.update(true, true, 0.0, start + 4s));
+        CHECK(detector.update(true, true, 0.0, start + 7s));
+
+        // 녹화가 끝나면 초기화되고, 다시 정체되면 다시 알린다
+        CHECK_FALSE(detector.update(false, true, 0.0, start + 8s));
+        CHECK_FALSE(detector.update(true, true, 0.0, start + 9s));
+        CHECK(detector.update(true, true, 0.0, start + 12s));
+
+        // /proc/<pid>/io를 못 읽으면 판단하지 않는다
+        sys::RecordingStallDetector unreadable(3s);
+        CHECK_FALSE(unreadable.update(true, false, 0.0, start));
+        CHECK_FALSE(unreadable.update(true, false, 0.0, start + 10s));
+    }
+}
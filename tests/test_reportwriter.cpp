@@ -54,7 +54,8 @@ TEST_SUITE("ReportWriter") {
                 std::getline(file, line);
                 
                 // Check header
-                std::string expectedHeader = "ts,rtt_ms,loss_pct,obs_dropped_ratio,avg_render_ms,cpu_pct,gpu_pct,mem_mb";
+                std::string expectedHeader = "ts,rtt_p50_ms,rtt_p90_ms,rtt_p99_ms,rtt_p999_ms,loss_pct,obs_dropped_ratio,"
+                                             "avg_render_ms,cpu_pct,gpu_pct,mem_mb,cores_busy,rtt_hist";
                 CHECK(line == expectedHeader);
                 break;
             }
@@ -90,7 +91,8 @@ TEST_SUITE("ReportWriter") {
                 CHECK(j["snapshots"].size() == 1);
                 
                 auto& snapshot = j["snapshots"][0];
-                CHECK(snapshot.contains("rtt_ms"));
+                CHECK(snapshot.contains("rtt"));
+                CHECK(snapshot["rtt"]["p99"] == 10.0);
                 CHECK(snapshot.contains("loss_pct"));
                 CHECK(snapshot.contains("obs_dropped_ratio"));
                 CHECK(snapshot.contains("avg_render_ms"));
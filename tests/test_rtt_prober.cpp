@@ -0,0 +1,270 @@
+#include <doctest/doctest.h>
+#include "../src/net/RttProber.h"
+#include "../src/net/JitterEstimator.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+// 루프백 임의 포트에 바인드한 소켓 (응답하지 않는 대상 / TCP 리스너용)
+int bindLoopback(int type, uint16_t& port) {
+    int fd = socket(AF_INET, type | SOCK_CLOEXEC, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    if (fd < 0 || bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0
+        || getsockname(fd, reinterpret_cast<sockaddr*>(&address), &length) < 0) {
+        if (fd >= 0) close(fd);
+        return -1;
+    }
+    port = ntohs(address.sin_port);
+    return fd;
+}
+
+net::ProbeTarget target(const std::string& text) {
+    net::ProbeTarget parsed;
+    REQUIRE(net::ProbeTarget::parse(text, parsed));
+    return parsed;
+}
+}
+
+TEST_SUITE("RttProber") {
+    TEST_CASE("Target strings select mode, host and port") {
+        auto dns = target("8.8.8.8");
+        CHECK(dns.host == "8.8.8.8");
+        CHECK(dns.port == 53);
+        CHECK(dns.mode == net::ProbeMode::Tcp);
+
+        auto https = target("example.com:443");
+        CHECK(https.host == "example.com");
+        CHECK(https.port == 443);
+
+        auto echo = target("udp://127.0.0.1:7000");
+        CHECK(echo.mode == net::ProbeMode::Udp);
+        CHECK(echo.port == 7000);
+        CHECK(echo.toString() == "udp://127.0.0.1:7000");
+
+        auto v6 = target("udp://[::1]:7");
+        CHECK(v6.host == "::1");
+        CHECK(v6.toString() == "udp://[::1]:7");
+        CHECK(target("2001:4860:4860::8888").host == "2001:4860:4860::8888");
+
+        net::ProbeTarget bad;
+        CHECK_FALSE(net::ProbeTarget::parse("", bad));
+        CHECK_FALSE(net::ProbeTarget::parse("host:", bad));
+        CHECK_FALSE(net::ProbeTarget::parse("host:70000", bad));
+        CHECK_FALSE(net::ProbeTarget::parse("[::1", bad));
+    }
+
+    TEST_CASE("UDP echo hosts are probed concurrently with per-host sequence numbers") {
+        net::UdpEchoServer first, second;
+        REQUIRE(first.start());
+        REQUIRE(second.start());
+        uint16_t silent_port = 0;
+        int silent = bindLoopback(SOCK_DGRAM, silent_port);   // 받기만 하고 돌려주지 않는다
+        REQUIRE(silent >= 0);
+
+        net::RttProber prober;
+        prober.setTargets({target("udp://127.0.0.1:" + std::to_string(first.getPort())),
+                           target("udp://127.0.0.1:" + std::to_string(second.getPort())),
+                           target("udp://127.0.0.1:" + std::to_string(silent_port))});
+
+        for (uint32_t round = 1; round <= 3; ++round) {
+            auto start = net::RttProber::Clock::now();
+            const auto& result = prober.probe(200ms);
+            // 시간 초과 대상이 있어도 라운드는 timeout 한 번으로 끝난다
+            CHECK(net::RttProber::Clock::now() - start < 400ms);
+            CHECK(result.responded == 2);
+            CHECK(result.min_rtt_ms > 0.0);
+            CHECK(result.min_rtt_ms <= result.median_rtt_ms);
+
+            const auto& hosts = prober.getHosts();
+            REQUIRE(hosts.size() == 3);
+            for (const auto& host : hosts) {
+                CHECK(host.resolved);
+                CHECK(host.seq == round);
+                CHECK(host.sent == round);
+            }
+            CHECK(hosts[0].replied);
+            CHECK(hosts[1].replied);
+            CHECK_FALSE(hosts[2].replied);
+            CHECK(hosts[2].timeouts == round);
+            CHECK(hosts[0].received == round);
+        }
+        CHECK(first.getEchoed() == 3);
+        close(silent);
+    }
+
+    TEST_CASE("UDP replies are measured with kernel software timestamps") {
+        net::UdpEchoServer echo;
+        REQUIRE(echo.start());
+        net::RttProber prober;
+        prober.setTargets({target("udp://127.0.0.1:" + std::to_string(echo.getPort()))});
+
+        // 커널은 소켓 타임스탬프를 처음 켤 때 지연 활성화하므로 첫 패킷은 RX 시각이 빠질 수 있다
+        // (이때는 steady_clock으로 대체) - 한 번 돌려 켠 뒤부터 확인
+        REQUIRE(prober.probe(200ms).responded == 1);
+
+        for (int round = 0; round < 5; ++round) {
+            const auto& result = prober.probe(200ms);
+            REQUIRE(result.responded == 1);
+            const auto& host = prober.getHosts()[0];
+            REQUIRE(host.kernel_timestamped);
+            CHECK(host.kernel_rtt_ms > 0.0);
+            // 커널 구간은 사용자 공간 측정 구간 안에 들어간다
+            CHECK(host.kernel_rtt_ms <= host.user_rtt_ms);
+            CHECK(host.rtt_ms == host.kernel_rtt_ms);
+            CHECK(result.kernel_timestamped == 1);
+            CHECK(result.host_delay_ms == doctest::Approx(host.user_rtt_ms - host.kernel_rtt_ms));
+            CHECK(result.user_rtt_ms == host.user_rtt_ms);
+            CHECK(result.kernel_rtt_ms == host.kernel_rtt_ms);
+        }
+    }
+
+    TEST_CASE("Probe trains feed the per-host loss window") {
+        net::UdpEchoServer echo;
+        REQUIRE(echo.start());
+        uint16_t silent_port = 0;
+        int silent = bindLoopback(SOCK_DGRAM, silent_port);
+        REQUIRE(silent >= 0);
+
+        net::RttProber prober;
+        prober.setTrainLength(4);
+        prober.setTargets({target("udp://127.0.0.1:" + std::to_string(echo.getPort())),
+                           target("udp://127.0.0.1:" + std::to_string(silent_port)),
+                           target("127.0.0.1:" + std::to_string(silent_port))});   // TCP는 트레인 없음
+
+        for (int round = 1; round <= 2; ++round) {
+            const auto& result = prober.probe(100ms);
+            const auto& hosts = prober.getHosts();
+            CHECK(hosts[0].sent == 4u * round);
+            CHECK(hosts[0].received == 4u * round);
+            CHECK(hosts[0].loss.window == 4u * round);
+            CHECK(hosts[0].loss.lost == 0);
+
+            CHECK(hosts[1].timeouts == 4u * round);
+            CHECK(hosts[1].loss.loss_pct == doctest::Approx(100.0));
+            CHECK(hosts[1].loss.max_burst == 4u * round);   // 라운드를 넘어 이어진다
+
+            CHECK(hosts[2].sent == static_cast<uint64_t>(round));
+            CHECK(hosts[2].loss.window == static_cast<uint32_t>(round));
+
+            // (0 + 4r) / (4r + 4r + r)
+            CHECK(result.loss_pct == doctest::Approx(100.0 * 4 / 9));
+            CHECK(result.max_burst == 4u * round);
+        }
+        CHECK(echo.getEchoed() == 8);
+        close(silent);
+    }
+
+    TEST_CASE("Jitter follows the RFC 3550 recurrence") {
+        net::JitterEstimator jitter;
+        jitter.add(10.0);
+        CHECK(jitter.get() == 0.0);   // 첫 샘플은 기준
+        jitter.add(26.0);
+        CHECK(jitter.get() == doctest::Approx(1.0));             // 0 + (16 - 0) / 16
+        jitter.add(10.0);
+        CHECK(jitter.get() == doctest::Approx(1.0 + 15.0 / 16));  // 1 + (16 - 1) / 16
+
+        // 일정한 RTT에서는 0으로, 일정한 교대 변동에서는 |D|로 수렴
+        net::JitterEstimator steady;
+        for (int i = 0; i < 400; ++i) steady.add(i % 2 ? 22.0 : 20.0);
+        CHECK(steady.get() == doctest::Approx(2.0).epsilon(0.001));
+        for (int i = 0; i < 400; ++i) steady.add(20.0);
+        CHECK(steady.get() < 0.001);
+        CHECK(steady.getCount() == 800);
+    }
+
+    TEST_CASE("Jitter is tracked per host from every reply") {
+        net::UdpEchoServer echo;
+        REQUIRE(echo.start());
+        net::RttProber prober;
+        prober.setTrainLength(4);
+        prober.setTargets({target("udp://127.0.0.1:" + std::to_string(echo.getPort()))});
+        prober.probe(200ms);
+        CHECK(prober.getHosts()[0].received == 4);
+        core::LatencyHistogram interval;
+        REQUIRE(prober.takeInterval(0, interval));
+        CHECK(interval.getTotalCount() == 4);   // 트레인의 모든 응답
+        CHECK(interval.getMinMs() > 0.0);
+        REQUIRE(prober.takeInterval(0, interval));
+        CHECK(interval.getTotalCount() == 0);   // 가져가면 비워진다
+        CHECK_FALSE(prober.takeInterval(1, interval));
+
+        for (int round = 0; round < 5; ++round) {
+            const auto& result = prober.probe(200ms);
+            const auto& host = prober.getHosts()[0];
+            CHECK(host.jitter_ms >= 0.0);
+            CHECK(host.jitter_ms < 50.0);   // 루프백
+            CHECK(result.jitter_ms == host.jitter_ms);
+        }
+    }
+
+    TEST_CASE("Late replies from an earlier round are counted as stale") {
+        uint16_t port = 0;
+        int server = bindLoopback(SOCK_DGRAM, port);
+        REQUIRE(server >= 0);
+
+        net::RttProber prober;
+        prober.setTargets({target("udp://127.0.0.1:" + std::to_string(port))});
+        prober.probe(20ms);
+        CHECK(prober.getHosts()[0].timeouts == 1);
+
+        // 1번 라운드 프로브를 라운드가 끝난 뒤에 돌려준다
+        net::RttProber::Payload payload{};
+        sockaddr_in peer{};
+        socklen_t length = sizeof(peer);
+        REQUIRE(recvfrom(server, &payload, sizeof(payload), 0, reinterpret_cast<sockaddr*>(&peer), &length)
+                == static_cast<ssize_t>(sizeof(payload)));
+        CHECK(payload.magic == net::RttProber::kMagic);
+        CHECK(payload.seq == 1);
+        sendto(server, &payload, sizeof(payload), 0, reinterpret_cast<sockaddr*>(&peer), length);
+
+        const auto& result = prober.probe(20ms);
+        CHECK(result.responded == 0);
+        CHECK(prober.getHosts()[0].stale == 1);
+        CHECK(prober.getHosts()[0].timeouts == 2);
+        CHECK(prober.getHosts()[0].received == 0);
+        close(server);
+    }
+
+    TEST_CASE("TCP connect and refusal both count as a round trip") {
+        uint16_t open_port = 0;
+        int listener = bindLoopback(SOCK_STREAM, open_port);
+        REQUIRE(listener >= 0);
+        REQUIRE(listen(listener, 4) == 0);
+        uint16_t closed_port = 0;
+        int closed = bindLoopback(SOCK_STREAM, closed_port);   // 바인드만 - listen하지 않으면 RST
+        REQUIRE(closed >= 0);
+
+        net::RttProber prober;
+        prober.setTargets({target("127.0.0.1:" + std::to_string(open_port)),
+                           target("127.0.0.1:" + std::to_string(closed_port))});
+        for (int round = 0; round < 2; ++round) {
+            const auto& result = prober.probe(500ms);
+            CHECK(result.responded == 2);
+            CHECK(prober.getHosts()[0].replied);
+            CHECK(prober.getHosts()[1].replied);
+            CHECK(prober.getHosts()[1].timeouts == 0);
+            // TCP는 SYN/SYN-ACK 타임스탬프를 받을 수 없어 steady_clock으로 잰다
+            CHECK_FALSE(prober.getHosts()[0].kernel_timestamped);
+            CHECK(prober.getHosts()[0].rtt_ms == prober.getHosts()[0].user_rtt_ms);
+        }
+        close(closed);
+        close(listener);
+    }
+
+    TEST_CASE("Unresolvable targets are skipped") {
+        net::RttProber prober;
+        prober.setTargets({target("liveops-missing.invalid:80")});
+        const auto& result = prober.probe(10ms);
+        CHECK(result.responded == 0);
+        CHECK(result.median_rtt_ms == 0.0);
+        CHECK_FALSE(prober.getHosts()[0].resolved);
+        CHECK(prober.getHosts()[0].sent == 0);
+    }
+}
@@ -0,0 +1,122 @@
+#include <doctest/doctest.h>
+#include "../src/core/Scheduler.h"
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST_SUITE("Scheduler") {
+    TEST_CASE("Deadlines stay on the absolute grid despite slow callbacks") {
+        core::Scheduler scheduler;
+        std::vector<core::Scheduler::Clock::time_point> deadlines;
+
+        scheduler.addTask("slow", 20ms, [&](const core::TickInfo& tick) {
+            deadlines.push_back(tick.deadline);
+            std::this_thread::sleep_for(5ms);  // 수집 시간 시뮬레이션
+            if (deadlines.size() >= 8) {
+                scheduler.stop();
+            }
+        });
+
+        std::atomic<bool> running{true};
+        scheduler.run(running);
+
+        REQUIRE(deadlines.size() >= 8);
+        for (size_t i = 1; i < deadlines.size(); ++i) {
+            // 수집 시간만큼 밀리지 않고 정확히 한 주기씩 진행
+            auto step = deadlines[i] - deadlines[i - 1];
+            CHECK(step % 20ms == 0ns);
+            CHECK(step >= 20ms);
+        }
+    }
+
+    TEST_CASE("Overrunning task skips missed periods") {
+        core::Scheduler scheduler;
+        int calls = 0;
+
+        scheduler.addTask("overrun", 10ms, [&](const core::TickInfo&) {
+            if (++calls == 1) {
+                std::this_thread::sleep_for(45ms);
+            } else {
+                scheduler.stop();
+            }
+        });
+
+        std::atomic<bool> running{true};
+        scheduler.run(running);
+
+        auto stats = scheduler.getStats();
+        REQUIRE(stats.size() == 1);
+        CHECK(stats[0].fired == 2);
+        CHECK(stats[0].skipped >= 3);
+        CHECK(stats[0].name == "overrun");
+    }
+
+    TEST_CASE("Tasks sharing a tick fire in registration order") {
+        core::Scheduler scheduler;
+        std::vector<int> order;
+
+        scheduler.addTask("collect", 10ms, [&](const core::TickInfo&) { order.push_back(1); });
+        scheduler.addTask("emit", 20ms, [&](const core::TickInfo&) {
+            order.push_back(2);
+            if (order.size() >= 9) {
+                scheduler.stop();
+            }
+        });
+
+        std::atomic<bool> running{true};
+        scheduler.run(running);
+
+        // emit 직전에는 항상 같은 틱의 collect가 실행되어 있어야 함
+        for (size_t i = 0; i < order.size(); ++i) {
+            if (order[i] == 2) {
+                REQUIRE(i > 0);
+                CHECK(order[i - 1] == 1);
+            }
+        }
+    }
+
+    TEST_CASE("Lateness is reported relative to the deadline") {
+        core::Scheduler scheduler;
+        scheduler.addTask("probe", 5ms, [](const core::TickInfo& tick) {
+            CHECK(tick.fired_at >= tick.deadline);
+            CHECK(tick.lateness >= 0us);
+        });
+
+        std::this_thread::sleep_for(30ms);
+        CHECK(scheduler.poll(core::Scheduler::Clock::now()) == 1);
+
+        auto stats = scheduler.getStats();
+        CHECK(stats[0].last_lateness >= 20ms);  // 마감 이후 늦게 poll 했으므로
+        CHECK(stats[0].skipped >= 4);
+        CHECK(scheduler.nextWakeup() > core::Scheduler::Clock::now() - 1ms);
+    }
+
+    TEST_CASE("Wake runs a task immediately without moving its deadline") {
+        core::Scheduler scheduler;
+        std::vector<core::TickInfo> ticks;
+
+        int task = scheduler.addTask("emit", 10s, [&](const core::TickInfo& tick) {
+            ticks.push_back(tick);
+            scheduler.stop();
+        });
+
+        std::thread waker([&] {
+            std::this_thread::sleep_for(20ms);
+            scheduler.wake(task);
+        });
+
+        auto start = core::Scheduler::Clock::now();
+        std::atomic<bool> running{true};
+        scheduler.run(running);
+        waker.join();
+
+        REQUIRE(ticks.size() == 1);
+        CHECK(ticks[0].woken);
+        CHECK(ticks[0].fired_at - start < 5s);   // 10초 주기를 기다리지 않음
+        CHECK(ticks[0].sequence == 1);           // 첫 주기 번호 그대로 (마감 이동 없음)
+        CHECK(scheduler.getStats()[0].woken == 1);
+        CHECK(scheduler.getStats()[0].fired == 0);
+    }
+}
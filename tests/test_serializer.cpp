@@ -0,0 +1,152 @@
+#include <doctest/doctest.h>
+#include "../src/ipc/MetricsSerializer.h"
+#include "../src/core/Base64.h"
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+
+namespace {
+// 기존 main.cpp 출력 경로와 동일한 DOM 직렬화
+std::string coresText(const core::MetricFrame& line, const ipc::CoreArray& values) {
+    return core::base64Encode(values.data(), line.cores.count);
+}
+
+std::string referenceLine(const core::MetricFrame& line) {
+    nlohmann::json snapshot = {
+        {"event", "metrics"},
+        {"cores_busy", coresText(line, line.cores.busy)},
+        {"cores_iowait", coresText(line, line.cores.iowait)},
+        {"cores_net_rx", coresText(line, line.cores.net_rx)},
+        {"cores_steal", coresText(line, line.cores.steal)},
+        {"ts", line.ts},
+        {"cpu_pct", line[core::MetricId::CpuPct]},
+        {"cpu_user_pct", line[core::MetricId::CpuUserPct]},
+        {"cpu_system_pct", line[core::MetricId::CpuSystemPct]},
+        {"cpu_iowait_pct", line[core::MetricId::CpuIowaitPct]},
+        {"cpu_steal_pct", line[core::MetricId::CpuStealPct]},
+        {"memory_pct", line[core::MetricId::MemoryPct]},
+        {"mem_mb", line[core::MetricId::MemMb]},
+        {"gpu_pct", line[core::MetricId::GpuPct]},
+        {"rtt_ms", line[core::MetricId::RttMs]},
+        {"loss_pct", line[core::MetricId::LossPct]},
+        {"uplink_kbps", line[core::MetricId::UplinkKbps]},
+        {"tick_late_ms", line[core::MetricId::TickLateMs]}
+    };
+    for (const auto& info : core::kMetricRegistry) {
+        if (info.source == core::MetricSource::Pressure || info.source == core::MetricSource::Cgroup
+            || info.source == core::MetricSource::Interrupt || info.source == core::MetricSource::Network
+            || info.source == core::MetricSource::Disk) {
+            snapshot[std::string(info.key)] = line[info.id];
+        }
+    }
+    return snapshot.dump() + "\n";
+}
+}
+
+TEST_SUITE("MetricsSerializer") {
+    TEST_CASE("Output is byte-identical to nlohmann::json::dump") {
+        ipc::MetricsSerializer serializer;
+        core::MetricFrame line;
+        line.ts = 1792146164;
+        line[core::MetricId::CpuPct] = 12.5;
+        line[core::MetricId::CpuUserPct] = 9.25;
+        line[core::MetricId::CpuSystemPct] = 3.25;
+        line[core::MetricId::CpuStealPct] = 0.0123;
+        line[core::MetricId::MemoryPct] = 24.535477526374798;
+        line[core::MetricId::MemMb] = 1475.51953125;
+        line[core::MetricId::GpuPct] = 0.0;
+        line[core::MetricId::RttMs] = 36.78949989509777;
+        line[core::MetricId::LossPct] = 100.0;
+        line[core::MetricId::UplinkKbps] = 7797.860985808279;
+        line[core::MetricId::TickLateMs] = 0.35;
+        line.cores.count = 5;
+        line.cores.busy = {200, 0, 17, 99, 1};
+        line.cores.iowait = {0, 3};
+        line.cores.steal = {1, 1, 1, 1, 1};
+        line.cores.net_rx = {0, 0, 190, 10};
+        line[core::MetricId::SoftirqNetRxPerSec] = 48211.5;
+
+        CHECK(serializer.serialize(line) == referenceLine(line));
+    }
+
+    TEST_CASE("Core arrays are base64 of count bytes") {
+        const uint8_t bytes[] = {'f', 'o', 'o', 'b', 'a', 'r'};
+        CHECK(core::base64Encode(bytes, 0) == "");
+        CHECK(core::base64Encode(bytes, 1) == "Zg==");
+        CHECK(core::base64Encode(bytes, 2) == "Zm8=");
+        CHECK(core::base64Encode(bytes, 3) == "Zm9v");
+        CHECK(core::base64Encode(bytes, 6) == "Zm9vYmFy");
+
+        // 최대 코어 수도 버퍼 안에 들어가야 한다
+        ipc::MetricsSerializer serializer;
+        core::MetricFrame line;
+        line.cores.count = core::CoreLoad::kMaxCores;
+        line.cores.busy.fill(core::CoreLoad::kMaxValue);
+        line.cores.steal.fill(255);
+        line[core::MetricId::MemMb] = -std::numeric_limits<double>::max();
+        CHECK(serializer.serialize(line) == referenceLine(line));
+    }
+
+    TEST_CASE("Special and extreme values match") {
+        ipc::MetricsSerializer serializer;
+        const double specials[] = {
+            -0.0, 1e-300, 5e-324, 1e21, 1e15, 123456789012345678.0, 0.1, 1.0 / 3.0,
+            -42.0, std::numeric_limits<double>::max(),
+            std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::infinity()
+        };
+
+        for (double value : specials) {
+            core::MetricFrame line;
+            line.ts = -1;
+            line[core::MetricId::CpuPct] = value;
+            line[core::MetricId::RttMs] = -value;
+            CHECK(serializer.serialize(line) == referenceLine(line));
+        }
+    }
+
+    TEST_CASE("Random samples match") {
+        ipc::MetricsSerializer serializer;
+        std::mt19937_64 gen(42);
+        std::uniform_real_distribution<> pct(0.0, 100.0);
+        std::uniform_real_distribution<> exponent(-20.0, 20.0);
+
+        bool all_equal = true;
+        for (int i = 0; i < 5000; ++i) {
+            core::MetricFrame line;
+            line.ts = static_cast<int64_t>(gen());
+            line[core::MetricId::CpuPct] = pct(gen);
+            line[core::MetricId::CpuUserPct] = pct(gen);
+            line[core::MetricId::CpuIowaitPct] = pct(gen) / 100.0;
+            line[core::MetricId::MemoryPct] = pct(gen);
+            line[core::MetricId::MemMb] = std::pow(10.0, exponent(gen));
+            line[core::MetricId::GpuPct] = std::round(pct(gen));
+            line[core::MetricId::RttMs] = pct(gen) * 3.0;
+            line[core::MetricId::LossPct] = pct(gen) / 1000.0;
+            line[core::MetricId::UplinkKbps] = std::pow(10.0, exponent(gen));
+            line[core::MetricId::TickLateMs] = -pct(gen);
+            line[core::MetricId::PsiIoSomeAvg10] = std::round(pct(gen) * 100.0) / 100.0;
+            line[core::MetricId::PsiIoSomeUs] = std::round(std::pow(10.0, exponent(gen) / 3.0));
+            all_equal = all_equal && (serializer.serialize(line) == referenceLine(line));
+        }
+        CHECK(all_equal);
+    }
+
+    TEST_CASE("Schema handshake lists every field") {
+        auto fields = ipc::schemaFields();
+        REQUIRE(fields.size() == ipc::kMetricsSchema.size());
+        // 필드는 키 순서로 정렬된다 - 위치 대신 이름으로 찾는다
+        auto field = [&](const char* name) {
+            for (const auto& entry : fields) {
+                if (entry["name"] == name) return entry;
+            }
+            return nlohmann::json{};
+        };
+        CHECK(field("cores_busy")["type"] == "u8b64");
+        CHECK(field("cores_busy")["scale"] == core::CoreLoad::kScale);
+        CHECK(field("cpu_iowait_pct")["type"] == "float");
+        CHECK(field("cgroup_cpu_pct")["type"] == "float");
+        CHECK(field("event")["type"] == "str");
+        CHECK(ipc::toJson(core::MetricFrame{}).dump() + "\n" == referenceLine(core::MetricFrame{}));
+    }
+}
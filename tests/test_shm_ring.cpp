@@ -0,0 +1,138 @@
+#include <doctest/doctest.h>
+#include "../src/ipc/ShmRing.h"
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+std::string tempRingPath(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+}
+
+TEST_SUITE("ShmRing") {
+    TEST_CASE("Header describes the record layout") {
+        auto path = tempRingPath("liveops_shm_header.bin");
+        ipc::ShmRing ring;
+        REQUIRE(ring.open(path, 16));
+
+        std::vector<char> bytes(ipc::ShmRing::kHeaderSize);
+        std::ifstream file(path, std::ios::binary);
+        file.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+
+        ipc::ShmHeader header;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        CHECK(std::memcmp(header.magic, ipc::kShmMagic, sizeof(header.magic)) == 0);
+        CHECK(header.capacity == 16);
+        CHECK(header.record_size % 64 == 0);
+        CHECK(header.version == ipc::kShmVersion);
+        CHECK(header.field_count == ipc::kMetricsSchema.size());  // event 제외, core_count 추가
+        CHECK(std::strcmp(header.fields[0].name, "core_count") == 0);
+
+        bool found_ts = false;
+        bool found_cores = false;
+        std::set<std::string> names;
+        for (uint32_t i = 0; i < header.field_count; ++i) {
+            const auto& field = header.fields[i];
+            CHECK(names.insert(field.name).second);   // 잘린 이름끼리 겹치면 읽는 쪽 dict에서 덮어쓴다
+            bool is_array = field.type == static_cast<uint32_t>(ipc::ShmFieldType::U8Array);
+            CHECK(field.offset + (is_array ? field.count : 8) <= header.record_size);
+            if (std::strcmp(field.name, "ts") == 0) {
+                found_ts = true;
+                CHECK(field.type == static_cast<uint32_t>(ipc::ShmFieldType::Int64));
+            }
+            if (std::strcmp(field.name, "cores_busy") == 0) {
+                found_cores = true;
+                CHECK(is_array);
+                CHECK(field.count == core::CoreLoad::kMaxCores);
+            }
+        }
+        CHECK(found_ts);
+        CHECK(found_cores);
+        for (const auto& spec : ipc::kMetricsSchema) {
+            if (spec.kind != ipc::FieldSpec::Kind::Constant) {
+                CHECK(names.count(std::string(spec.key)) == 1);
+            }
+        }
+
+        ring.close();
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Published records read back until overwritten") {
+        auto path = tempRingPath("liveops_shm_wrap.bin");
+        ipc::ShmRing ring;
+        REQUIRE(ring.open(path, 4));
+
+        for (int i = 0; i < 6; ++i) {
+            core::MetricFrame line;
+            line.ts = 1000 + i;
+            line[core::MetricId::CpuPct] = i * 1.5;
+            line.cores.count = 3;
+            line.cores.busy = {static_cast<uint8_t>(i), 200, 7};
+            line.cores.steal[2] = 9;
+            ring.publish(line);
+        }
+        CHECK(ring.getWriteIndex() == 6);
+
+        core::MetricFrame out;
+        CHECK_FALSE(ring.read(0, out));   // 덮어쓰인 슬롯
+        CHECK_FALSE(ring.read(1, out));
+        CHECK_FALSE(ring.read(6, out));   // 아직 안 쓰임
+        REQUIRE(ring.read(5, out));
+        CHECK(out.ts == 1005);
+        CHECK(out[core::MetricId::CpuPct] == doctest::Approx(7.5));
+        CHECK(out.cores.count == 3);
+        CHECK(out.cores.busy[0] == 5);
+        CHECK(out.cores.busy[1] == 200);
+        CHECK(out.cores.steal[2] == 9);
+        CHECK(out.cores.busy[3] == 0);
+
+        ring.close();
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Concurrent reader never observes a torn record") {
+        auto path = tempRingPath("liveops_shm_torn.bin");
+        ipc::ShmRing ring;
+        REQUIRE(ring.open(path, 8));
+
+        std::atomic<bool> done{false};
+        std::thread writer([&] {
+            for (int64_t i = 0; i < 200000; ++i) {
+                core::MetricFrame line;
+                line.ts = i;
+                line[core::MetricId::CpuPct] = line[core::MetricId::MemoryPct] = line[core::MetricId::RttMs] =
+                    static_cast<double>(i);
+                ring.publish(line);
+            }
+            done = true;
+        });
+
+        uint64_t reads = 0;
+        bool consistent = true;
+        while (!done) {
+            uint64_t index = ring.getWriteIndex();
+            if (index == 0) continue;
+            core::MetricFrame out;
+            if (ring.read(index - 1, out)) {
+                ++reads;
+                double rtt = out[core::MetricId::RttMs];
+                consistent = consistent && out.ts == static_cast<int64_t>(index - 1)
+                             && out[core::MetricId::CpuPct] == rtt && out[core::MetricId::MemoryPct] == rtt;
+            }
+        }
+        writer.join();
+
+        CHECK(consistent);
+        CHECK(reads > 0);
+
+        ring.close();
+        std::filesystem::remove(path);
+    }
+}
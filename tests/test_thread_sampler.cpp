@@ -0,0 +1,105 @@
+#include <doctest/doctest.h>
+#include "../src/sys/ThreadSampler.h"
+#include "TempTree.h"
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <set>
+#include <string>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+using namespace std::chrono_literals;
+
+namespace {
+// 임시 디렉터리에 /proc/<pid>/task/<tid>/stat 모양의 트리 생성
+struct FakeTaskDir {
+    test::TempTree tree;
+    fs::path root;
+
+    explicit FakeTaskDir(const char* name) : tree(name), root(tree.root()) {}
+
+    void thread(int tid, const std::string& comm, uint64_t utime, uint64_t stime = 0) {
+        tree.mkdir(std::to_string(tid));
+        std::ofstream(root / std::to_string(tid) / "stat", std::ios::trunc)
+            << tid << " (" << comm << ") S 1 100 100 0 -1 4194560 10 0 0 0 " << utime << " " << stime
+            << " 0 0 20 0 8 0 5000 1000000 2000 18446744073709551615\n";
+    }
+    void remove(int tid) { tree.remove(std::to_string(tid)); }
+};
+}
+
+TEST_SUITE("ThreadSampler") {
+    TEST_CASE("TID table survives inserts and sweeps") {
+        sys::ThreadTable table(16);
+        std::set<int32_t> reference;
+        std::mt19937 gen(7);
+        std::uniform_int_distribution<int32_t> tid(1, 400);
+
+        uint32_t generation = 0;
+        for (int round = 0; round < 50; ++round) {
+            ++generation;
+            std::set<int32_t> alive;
+            for (int i = 0; i < 60; ++i) {
+                alive.insert(tid(gen));
+            }
+            for (auto id : alive) {
+                bool inserted = false;
+                auto& slot = table.findOrInsert(id, inserted);
+                CHECK(inserted == (reference.count(id) == 0));
+                slot.seen = generation;
+            }
+            table.sweep(generation);
+            reference = alive;
+
+            REQUIRE(table.size() == reference.size());
+            for (auto id : reference) {
+                CHECK(table.find(id) != nullptr);
+            }
+        }
+        CHECK(table.find(401) == nullptr);
+        CHECK(table.capacity() <= 256);   // 최대 60개 - 계속 커지지 않는다
+    }
+
+    TEST_CASE("Top threads are ranked by CPU delta") {
+        FakeTaskDir task("liveops_task_top");
+        task.thread(100, "obs64", 100);
+        task.thread(101, "obs-x264", 100);
+        task.thread(102, "libobs: graphi", 100);
+        task.thread(103, "idle", 100);
+
+        sys::ThreadSampler sampler(task.root.string(), 2);
+        auto t0 = sys::ThreadSampler::Clock::now();
+        REQUIRE(sampler.sample(t0));
+        CHECK(sampler.getTop().empty());   // 첫 샘플은 기준값
+        CHECK(sampler.getThreadCount() == 4);
+
+        double ticks = static_cast<double>(sysconf(_SC_CLK_TCK));
+        auto perSecond = [&](double cores) { return static_cast<uint64_t>(cores * ticks); };
+        task.thread(100, "obs64", 100 + perSecond(0.1));
+        task.thread(101, "obs-x264", 100 + perSecond(0.5), perSecond(0.4));
+        task.thread(102, "libobs: graphi", 100 + perSecond(0.3));
+        REQUIRE(sampler.sample(t0 + 1s));
+
+        const auto& top = sampler.getTop();
+        REQUIRE(top.size() == 2);
+        CHECK(top[0].tid == 101);
+        CHECK(top[0].getName() == "obs-x264");
+        CHECK(top[0].cpu_pct == doctest::Approx(90.0));
+        CHECK(top[1].tid == 102);
+        CHECK(top[1].cpu_pct == doctest::Approx(30.0));
+
+        // 종료된 스레드는 테이블에서 빠진다
+        task.remove(103);
+        REQUIRE(sampler.sample(t0 + 2s));
+        CHECK(sampler.getThreadCount() == 3);
+        CHECK(sampler.getTable().find(103) == nullptr);
+    }
+
+    TEST_CASE("Missing task directory is reported") {
+        test::TempTree tree("liveops_task_missing");
+        sys::ThreadSampler sampler(tree.path("task").string(), 3);
+        CHECK_FALSE(sampler.sample());
+        CHECK(sampler.getTop().empty());
+    }
+}
@@ -3,19 +3,45 @@ import json
 import os
 import sys
 
+FRAME_HEADER_SIZE = 4   # u32 little-endian 페이로드 길이
+
+
+def _load_decoder(ipc: str):
+    """바이너리 IPC 형식별 디코더 (jsonl이면 None)"""
+    if ipc == "msgpack":
+        import msgpack
+        return lambda payload: msgpack.unpackb(payload, raw=False)
+    if ipc == "cbor":
+        import cbor2
+        return cbor2.loads
+    return None
+
+
 class BackendProcess(QObject):
-    lineReceived = Signal(dict)        # JSON 라인
+    lineReceived = Signal(dict)        # JSON 라인 (바이너리 모드에서는 디코딩된 프레임)
     readyBanner = Signal(str)          # "BACKEND_READY ..." 원문
+    schemaReceived = Signal(dict)      # 스키마 핸드셰이크
     errorText = Signal(str)
 
-    def __init__(self, exe_path: str, parent=None):
+    def __init__(self, exe_path: str, parent=None, ipc: str = "jsonl", shm_path: str = ""):
         super().__init__(parent)
         self._buf = ""
+        self._frames = bytearray()
+        self._banner_seen = False
+        self._decode = _load_decoder(ipc)
         self.p = QProcess(self)
         self.p.setProgram(exe_path)
-        self.p.setArguments([])        # 절대 cmd.exe 래핑 금지
-        self.p.setProcessChannelMode(QProcess.MergedChannels)
-        self.p.readyReadStandardOutput.connect(self._on_read)
+        shm_args = [f"--shm={shm_path}"] if shm_path else []   # metrics는 공유 메모리 링으로
+        if self._decode is None:
+            self.p.setArguments(shm_args)  # 절대 cmd.exe 래핑 금지
+            self.p.setProcessChannelMode(QProcess.MergedChannels)
+            self.p.readyReadStandardOutput.connect(self._on_read)
+        else:
+            # 바이너리 모드: stdout은 프레임 전용, 로그는 stderr로 분리
+            self.p.setArguments([f"--ipc={ipc}"] + shm_args)
+            self.p.setProcessChannelMode(QProcess.SeparateChannels)
+            self.p.readyReadStandardOutput.connect(self._on_read_frames)
+            self.p.readyReadStandardError.connect(self._on_read_stderr)
         self.p.errorOccurred.connect(lambda e: self.errorText.emit(str(e)))
         self.p.finished.connect(lambda *_: self.errorText.emit("backend finished"))
 
@@ -30,6 +56,11 @@ class BackendProcess(QObject):
         self.p.write(payload.encode("utf-8"))
         self.p.waitForBytesWritten(1000)
 
+    def sendLine(self, text: str):
+        """백엔드 stdin 명령 (예: "recording on") - 백엔드는 평문 한 줄을 명령으로 파싱한다"""
+        self.p.write((text + "\n").encode("utf-8"))
+        self.p.waitForBytesWritten(1000)
+
     def _on_read(self):
         chunk = bytes(self.p.readAllStandardOutput()).decode("utf-8", errors="ignore")
         self._buf += chunk
@@ -51,6 +82,43 @@ class BackendProcess(QObject):
             except Exception as e:
                 self.errorText.emit(f"parse_error: {e}: {line[:200]}")
 
+    def _on_read_frames(self):
+        self._frames += bytes(self.p.readAllStandardOutput())
+        
+        # 배너는 텍스트 한 줄, 이후는 길이 접두 프레임
+        if not self._banner_seen:
+            idx = self._frames.find(b"\n")
+            if idx < 0:
+                return
+            self.readyBanner.emit(self._frames[:idx].decode("utf-8", errors="ignore").strip())
+            del self._frames[:idx + 1]
+            self._banner_seen = True
+        
+        offset = 0
+        while len(self._frames) - offset >= FRAME_HEADER_SIZE:
+            length = int.from_bytes(self._frames[offset:offset + FRAME_HEADER_SIZE], "little")
+            end = offset + FRAME_HEADER_SIZE + length
+            if len(self._frames) < end:
+                break
+            payload = bytes(self._frames[offset + FRAME_HEADER_SIZE:end])
+            offset = end
+            try:
+                obj = self._decode(payload)
+            except Exception as e:
+                self.errorText.emit(f"frame_decode_error: {e}")
+                continue
+            if obj.get("event") == "schema":
+                self.schemaReceived.emit(obj)
+            else:
+                self.lineReceived.emit(obj)
+        del self._frames[:offset]
+
+    def _on_read_stderr(self):
+        text = bytes(self.p.readAllStandardError()).decode("utf-8", errors="ignore")
+        for line in text.splitlines():
+            if line.strip():
+                print(f"[backend] {line}")
+
     def stop(self):
         try: 
             self.p.kill()
@@ -1,3 +1,4 @@
+import base64
 import json
 import threading
 import time
@@ -7,8 +8,12 @@ from typing import Callable, Dict, List, Tuple, Optional
 from PySide6.QtCore import QThread, QTimer, Signal, QObject
 from PySide6.QtWidgets import QApplication
 from .backend_process import BackendProcess
+from .shm_reader import ShmRingReader
 from .obs_client import ObsClient
 
+CORE_KEYS = ('cores_busy', 'cores_iowait', 'cores_steal', 'cores_net_rx')
+CORE_SCALE = 0.5    # 코어 배열 1바이트 = 0.5%
+
 class MetricBus(QObject):
     """백엔드 메트릭 수집 및 브로드캐스트"""
     
@@ -16,22 +21,61 @@ class MetricBus(QObject):
     new_metrics = Signal(dict)  # 새로운 메트릭 수신 시
     connection_lost = Signal()  # 백엔드 연결 끊김 시
     connection_established = Signal()  # 백엔드 연결 성공 시
+    pressure_stall = Signal(dict)  # PSI 트리거 발생 시 (틱과 무관하게 즉시)
+    process_exit = Signal(dict)  # 감시 프로세스(OBS) 종료 시 (pidfd, 틱과 무관하게 즉시)
+    rtt_hosts = Signal(list)  # 프로브 라운드마다 호스트별 RTT/지터/손실/분포 (hist = base64 히스토그램)
+    recording_stall = Signal(dict)  # 녹화 중 감시 프로세스의 저장 장치 쓰기가 멈췄을 때 (정체당 한 번)
+    process_stats = Signal(list)  # 수집 주기마다 감시 프로세스별 CPU/RSS/스레드 수
     
-    def __init__(self, backend_path: str):
+    def __init__(self, backend_path: str, ipc: str = "jsonl", shm_path: str = ""):
         super().__init__()
         self.backend_path = backend_path
+        self.ipc = ipc                  # 백엔드 출력 형식 (jsonl, msgpack, cbor)
+        self.shm_path = shm_path        # 설정 시 metrics는 공유 메모리 링에서 읽음
+        self.shm_reader: Optional[ShmRingReader] = None
         self.backend_process: Optional[BackendProcess] = None
         self.obs_client: Optional[ObsClient] = None
         self.is_running = False
+        self._recording = False         # 백엔드에 마지막으로 알린 OBS 녹화 상태
         
         # Ring buffers (60초 * 10Hz = 600 samples)
         self.buffers: Dict[str, deque] = {
             'net.rtt_ms': deque(maxlen=600),
+            'net.rtt_min_ms': deque(maxlen=600),
+            'net.rtt_user_ms': deque(maxlen=600),
+            'net.rtt_kernel_ms': deque(maxlen=600),
+            'net.rtt_host_delay_ms': deque(maxlen=600),
+            'net.jitter_ms': deque(maxlen=600),
+            'net.rtt_p50_ms': deque(maxlen=600),
+            'net.rtt_p90_ms': deque(maxlen=600),
+            'net.rtt_p99_ms': deque(maxlen=600),
+            'net.rtt_p999_ms': deque(maxlen=600),
             'net.loss_pct': deque(maxlen=600),
+            'net.loss_burst': deque(maxlen=600),
             'net.uplink_kbps': deque(maxlen=600),
+            'net.rx_kbps': deque(maxlen=600),
+            'net.tx_pps': deque(maxlen=600),
+            'net.rx_pps': deque(maxlen=600),
+            'net.errors_per_s': deque(maxlen=600),
+            'net.drops_per_s': deque(maxlen=600),
             'sys.cpu_pct': deque(maxlen=600),
             'sys.gpu_pct': deque(maxlen=600),
             'sys.mem_mb': deque(maxlen=600),
+            'sys.cpu_core_max_pct': deque(maxlen=600),
+            'psi.cpu_some_avg10': deque(maxlen=600),
+            'psi.mem_some_avg10': deque(maxlen=600),
+            'psi.io_some_avg10': deque(maxlen=600),
+            'disk.write_mbps': deque(maxlen=600),
+            'disk.await_ms': deque(maxlen=600),
+            'disk.util_pct': deque(maxlen=600),
+            'irq.ctxt_per_s': deque(maxlen=600),
+            'irq.net_rx_per_s': deque(maxlen=600),
+            'irq.net_rx_max_core_per_s': deque(maxlen=600),
+            'cgroup.cpu_pct': deque(maxlen=600),
+            'cgroup.throttled_pct': deque(maxlen=600),
+            'cgroup.mem_pct': deque(maxlen=600),
+            'proc.cpu_pct': deque(maxlen=600),
+            'proc.mem_mb': deque(maxlen=600),
             'obs.dropped_ratio': deque(maxlen=600),
             'obs.enc_lag_ms': deque(maxlen=600),
             'obs.render_lag_ms': deque(maxlen=600),
@@ -48,6 +92,10 @@ class MetricBus(QObject):
         self.update_timer.timeout.connect(self._broadcast_update)
         self.update_timer.start(250)  # 4Hz
         
+        # 공유 메모리 링 폴링 (10Hz, 파싱 없이 고정 레이아웃 레코드 복사)
+        self.shm_timer = QTimer()
+        self.shm_timer.timeout.connect(self._poll_shm)
+        
         # OBS 클라이언트 초기화
         self._init_obs_client()
         
@@ -59,14 +107,20 @@ class MetricBus(QObject):
         print(f"백엔드 시작 시도: {self.backend_path}")
         
         try:
-            self.backend_process = BackendProcess(self.backend_path, self)
+            self.backend_process = BackendProcess(self.backend_path, self, ipc=self.ipc,
+                                                  shm_path=self.shm_path)
             self.backend_process.lineReceived.connect(self._process_metrics)
             self.backend_process.readyBanner.connect(self._on_backend_ready)
             self.backend_process.errorText.connect(self._on_backend_error)
             self.backend_process.start()
             
+            if self.shm_path:
+                self.shm_reader = ShmRingReader(self.shm_path)
+                self.shm_timer.start(100)
+            
             print(f"백엔드 프로세스 시작됨")
             self.is_running = True
+            self._recording = False     # 새 백엔드는 녹화 꺼짐 상태로 시작
             
         except Exception as e:
             print(f"백엔드 시작 실패: {e}")
@@ -78,6 +132,11 @@ class MetricBus(QObject):
         """백엔드 프로세스 종료"""
         self.is_running = False
         
+        self.shm_timer.stop()
+        if self.shm_reader:
+            self.shm_reader.close()
+            self.shm_reader = None
+        
         if self.backend_process:
             try:
                 self.backend_process.stop()
@@ -130,6 +189,18 @@ class MetricBus(QObject):
             print(f"명령 전송 실패: {e}")
             self.connection_lost.emit()
     
+    def set_recording(self, recording: bool):
+        """OBS 녹화 상태를 백엔드에 알림 (바뀔 때만 전송)"""
+        if not self.backend_process or not self.is_running:
+            return
+        if recording == self._recording:
+            return
+        try:
+            self.backend_process.sendLine("recording on" if recording else "recording off")
+            self._recording = recording
+        except Exception as e:
+            print(f"녹화 상태 전송 실패: {e}")
+
     def _on_backend_ready(self, banner: str):
         """백엔드 레디 배너 수신"""
         print(f"백엔드 준비됨: {banner}")
@@ -139,10 +210,39 @@ class MetricBus(QObject):
         print(f"백엔드 오류: {error}")
         self.connection_lost.emit()
     
+    def _poll_shm(self):
+        """공유 메모리 링에서 새 레코드를 읽어 버퍼에 저장"""
+        if not self.shm_reader:
+            return
+        if not self.shm_reader.open():
+            return  # 백엔드가 아직 링을 만들지 않음
+        for record in self.shm_reader.read_new():
+            self._process_metrics(record)
+    
     def _process_metrics(self, data: dict):
         """메트릭 데이터 처리 및 버퍼 저장"""
         # print(f"메트릭 수신: {data}")
         
+        if data.get('event') == 'pressure_stall':
+            self.pressure_stall.emit(data)
+            return
+
+        if data.get('event') == 'process_exit':
+            self.process_exit.emit(data)
+            return
+
+        if data.get('event') == 'rtt_hosts':
+            self.rtt_hosts.emit(data.get('hosts', []))
+            return
+
+        if data.get('event') == 'recording_stall':
+            self.recording_stall.emit(data)
+            return
+
+        if data.get('event') == 'process_stats':
+            self._process_stats(data)
+            return
+        
         if 'event' not in data or data['event'] != 'metrics':
             # print(f"메트릭 이벤트가 아님: {data.get('event', 'no_event')}")
             return
@@ -159,14 +259,49 @@ class MetricBus(QObject):
         
         # Store in buffers
         self._store_metric('net.rtt_ms', ts, data.get('rtt_ms', 0))
+        self._store_metric('net.rtt_min_ms', ts, data.get('rtt_min_ms', 0))
+        self._store_metric('net.rtt_user_ms', ts, data.get('rtt_user_ms', 0))
+        self._store_metric('net.rtt_kernel_ms', ts, data.get('rtt_kernel_ms', 0))
+        self._store_metric('net.rtt_host_delay_ms', ts, data.get('rtt_host_delay_ms', 0))
+        self._store_metric('net.jitter_ms', ts, data.get('jitter_ms', 0))
+        self._store_metric('net.rtt_p50_ms', ts, data.get('rtt_p50_ms', 0))
+        self._store_metric('net.rtt_p90_ms', ts, data.get('rtt_p90_ms', 0))
+        self._store_metric('net.rtt_p99_ms', ts, data.get('rtt_p99_ms', 0))
+        self._store_metric('net.rtt_p999_ms', ts, data.get('rtt_p999_ms', 0))
         self._store_metric('net.loss_pct', ts, data.get('loss_pct', 0))
+        self._store_metric('net.loss_burst', ts, data.get('loss_burst', 0))
         self._store_metric('net.uplink_kbps', ts, data.get('uplink_kbps', 0))
+        self._store_metric('net.rx_kbps', ts, data.get('net_rx_kbps', 0))
+        self._store_metric('net.tx_pps', ts, data.get('net_tx_pps', 0))
+        self._store_metric('net.rx_pps', ts, data.get('net_rx_pps', 0))
+        self._store_metric('net.errors_per_s', ts, data.get('net_errors_per_s', 0))
+        self._store_metric('net.drops_per_s', ts, data.get('net_drops_per_s', 0))
         
         # System metrics
         self._store_metric('sys.cpu_pct', ts, data.get('cpu_pct', 0))
         self._store_metric('sys.gpu_pct', ts, data.get('gpu_pct', 0))
         self._store_metric('sys.mem_mb', ts, data.get('mem_mb', 0))
         
+        # PSI (정체 시간 비율 %)
+        self._store_metric('psi.cpu_some_avg10', ts, data.get('psi_cpu_some_avg10', 0))
+        self._store_metric('psi.mem_some_avg10', ts, data.get('psi_mem_some_avg10', 0))
+        self._store_metric('psi.io_some_avg10', ts, data.get('psi_io_some_avg10', 0))
+        self._store_metric('disk.write_mbps', ts, data.get('disk_write_mbps', 0))
+        self._store_metric('disk.await_ms', ts, data.get('disk_await_ms', 0))
+        self._store_metric('disk.util_pct', ts, data.get('disk_util_pct', 0))
+        self._store_metric('irq.ctxt_per_s', ts, data.get('ctxt_per_s', 0))
+        self._store_metric('irq.net_rx_per_s', ts, data.get('softirq_net_rx_per_s', 0))
+        self._store_metric('irq.net_rx_max_core_per_s', ts, data.get('softirq_net_rx_max_per_s', 0))
+        self._store_metric('cgroup.cpu_pct', ts, data.get('cgroup_cpu_pct', 0))
+        self._store_metric('cgroup.throttled_pct', ts, data.get('cgroup_throttled_pct', 0))
+        self._store_metric('cgroup.mem_pct', ts, data.get('cgroup_mem_pct', 0))
+        
+        # 코어별 값 (base64 문자열 또는 공유 메모리의 bytes -> % 리스트)
+        self._decode_cores(data)
+        busy = data.get('cores_busy')
+        if busy:
+            self._store_metric('sys.cpu_core_max_pct', ts, max(busy))
+        
         # OBS metrics (현재는 시뮬레이션 데이터)
         obs = data.get('obs', {})
         self._store_metric('obs.dropped_ratio', ts, obs.get('dropped_ratio', 0))
@@ -183,6 +318,26 @@ class MetricBus(QObject):
         # 메트릭 수신 시 연결 상태 업데이트
         self.connection_established.emit()
     
+    def _process_stats(self, data: dict):
+        """감시 프로세스 합계를 시스템 CPU와 나란히 버퍼에 저장"""
+        processes = data.get('processes', [])
+        running = [p for p in processes if p.get('running')]
+        ts = float(data.get('ts', time.time()))
+        self._store_metric('proc.cpu_pct', ts, sum(p.get('cpu_pct', 0) for p in running))
+        self._store_metric('proc.mem_mb', ts, sum(p.get('mem_mb', 0) for p in running))
+        self.process_stats.emit(processes)
+
+    def _decode_cores(self, data: dict):
+        for key in CORE_KEYS:
+            raw = data.get(key)
+            if isinstance(raw, str):
+                try:
+                    raw = base64.b64decode(raw)
+                except ValueError:
+                    raw = b''
+            if isinstance(raw, (bytes, bytearray)):
+                data[key] = [value * CORE_SCALE for value in raw]
+    
     def _init_obs_client(self):
         """OBS 클라이언트 초기화"""
         try:
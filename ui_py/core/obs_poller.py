@@ -39,7 +39,8 @@ class ObsPoller(QObject):
             'encoding_lag_ms': 0.0,
             'render_lag_ms': 0.0,
             'fps': 0.0,
-            'bitrate_kbps': 0.0
+            'bitrate_kbps': 0.0,
+            'recording': False
         }
         
         # OBS 설정 캐시
@@ -170,6 +171,10 @@ class ObsPoller(QObject):
                         render_lag_ms = float(stats.average_frame_render_time)
                     fps = stream_stats.fps if hasattr(stream_stats, 'fps') else 0.0
                     bitrate = stream_stats.bitrate / 1000.0 if hasattr(stream_stats, 'bitrate') and stream_stats.bitrate else 0.0
+
+                    # 로컬 녹화 상태 (백엔드 녹화 쓰기 정체 감지에 전달)
+                    record_status = self._client.get_record_status()
+                    recording = bool(getattr(record_status, 'output_active', False))
                     
                     # 메트릭 업데이트
                     self.latest_metrics.update({
@@ -177,7 +182,8 @@ class ObsPoller(QObject):
                         'encoding_lag_ms': encoding_lag_ms,
                         'render_lag_ms': render_lag_ms,
                         'fps': fps,
-                        'bitrate_kbps': bitrate
+                        'bitrate_kbps': bitrate,
+                        'recording': recording
                     })
                     
                     print(f"OBS Poller 메트릭: dropped={dropped_ratio:.3f}, enc_ms={encoding_lag_ms:.2f}ms, render_ms={render_lag_ms:.2f}ms, fps={fps}, bitrate={bitrate:.1f}kbps")
@@ -0,0 +1,132 @@
+import mmap
+import os
+import struct
+from typing import Dict, List, Optional
+
+# src/ipc/ShmRing.h 와 같은 레이아웃 (리틀엔디언)
+SHM_MAGIC = b"LOSHMRNG"
+SHM_VERSION = 3
+HEADER_STRUCT = struct.Struct("<8sIIIIIIQ")     # magic ~ write_index
+WRITE_INDEX_OFFSET = 32
+FIELDS_OFFSET = 64
+FIELD_STRUCT = struct.Struct("<32sIII")         # name, offset, type, count
+FIELD_TYPES = {1: "d", 2: "q"}                  # Float64, Int64
+FIELD_U8_ARRAY = 3                              # 코어별 양자화 값 (count 바이트)
+CORE_COUNT_FIELD = "core_count"
+SEQ_STRUCT = struct.Struct("<Q")
+
+
+class ShmRingReader:
+    """백엔드 공유 메모리 메트릭 링 읽기 (--shm=<path>)
+
+    레코드마다 seqlock(seq == 2*index+2)을 확인하므로 쓰는 중이거나
+    이미 덮어쓰인 레코드는 건너뛴다.
+    """
+
+    def __init__(self, path: str):
+        self.path = path
+        self._file = None
+        self._map: Optional[mmap.mmap] = None
+        self._record: Optional[struct.Struct] = None
+        self._names: List[str] = []
+        self._arrays: List[str] = []
+        self.header_size = 0
+        self.record_size = 0
+        self.capacity = 0
+        self.next_index = 0     # 다음에 읽을 레코드 인덱스
+
+    def open(self) -> bool:
+        """매핑 시도 (백엔드가 아직 파일을 만들지 않았으면 False)"""
+        if self._map is not None:
+            return True
+        try:
+            if os.path.getsize(self.path) < FIELDS_OFFSET:
+                return False
+            self._file = open(self.path, "rb")
+            self._map = mmap.mmap(self._file.fileno(), 0, access=mmap.ACCESS_READ)
+        except (OSError, ValueError):
+            self.close()
+            return False
+
+        magic, version, header_size, record_size, capacity, field_count, _pid, _index = \
+            HEADER_STRUCT.unpack_from(self._map, 0)
+        if magic != SHM_MAGIC or version != SHM_VERSION or capacity == 0:
+            self.close()
+            return False
+
+        # 필드 오프셋으로 레코드 하나를 한 번에 푸는 struct 포맷 구성
+        fields = []
+        for i in range(field_count):
+            raw_name, offset, ftype, count = FIELD_STRUCT.unpack_from(
+                self._map, FIELDS_OFFSET + i * FIELD_STRUCT.size)
+            name = raw_name.split(b"\0", 1)[0].decode("ascii")
+            if ftype == FIELD_U8_ARRAY:
+                fields.append((offset, name, f"{count}s", count))
+            else:
+                fields.append((offset, name, FIELD_TYPES.get(ftype, "d"), 8))
+        fields.sort()
+
+        fmt = "<"
+        cursor = SEQ_STRUCT.size
+        for offset, name, code, size in fields:
+            fmt += "x" * (offset - cursor) + code
+            cursor = offset + size
+        self._record = struct.Struct(fmt)
+        self._names = [name for _, name, _, _ in fields]
+        self._arrays = [name for _, name, code, _ in fields if code.endswith("s")]
+
+        self.header_size = header_size
+        self.record_size = record_size
+        self.capacity = capacity
+        self.next_index = 0
+        return True
+
+    def close(self):
+        if self._map is not None:
+            self._map.close()
+            self._map = None
+        if self._file is not None:
+            self._file.close()
+            self._file = None
+
+    def write_index(self) -> int:
+        if self._map is None:
+            return 0
+        return SEQ_STRUCT.unpack_from(self._map, WRITE_INDEX_OFFSET)[0]
+
+    def read(self, index: int) -> Optional[Dict]:
+        """레코드 하나 읽기 (찢어졌거나 덮어쓰였으면 None)"""
+        base = self.header_size + (index % self.capacity) * self.record_size
+        expected = 2 * index + 2
+        if SEQ_STRUCT.unpack_from(self._map, base)[0] != expected:
+            return None
+        values = self._record.unpack_from(self._map, base + SEQ_STRUCT.size)
+        if SEQ_STRUCT.unpack_from(self._map, base)[0] != expected:
+            return None
+        record = dict(zip(self._names, values))
+        # 코어 배열은 유효 코어 수만큼만 (bytes, 값 x 0.5 = %)
+        core_count = record.pop(CORE_COUNT_FIELD, 0)
+        for name in self._arrays:
+            record[name] = record[name][:core_count]
+        record["event"] = "metrics"
+        return record
+
+    def latest(self, count: int) -> List[Dict]:
+        """최근 count개 레코드 (오래된 것부터)"""
+        if self._map is None:
+            return []
+        end = self.write_index()
+        start = max(0, end - min(count, self.capacity))
+        return [r for r in (self.read(i) for i in range(start, end)) if r is not None]
+
+    def read_new(self) -> List[Dict]:
+        """마지막 호출 이후 게시된 레코드 (링 용량을 넘게 밀렸으면 남은 것만)"""
+        if self._map is None:
+            return []
+        end = self.write_index()
+        if end < self.next_index:
+            # 백엔드 재시작으로 링이 다시 만들어짐
+            self.next_index = 0
+        start = max(self.next_index, end - self.capacity)
+        self.next_index = end
+        return [r for r in (self.read(i) for i in range(start, end)) if r is not None]
@@ -64,7 +64,8 @@ def main():
             backend_path = default_backend_path()
         
         # MetricBus 초기화
-        metric_bus = MetricBus(backend_path)
+        metric_bus = MetricBus(backend_path, ipc=cfg.get("ipc", "jsonl"),
+                               shm_path=cfg.get("shm_path", ""))
         metric_bus.start()
         
         # 대시보드 뷰 생성
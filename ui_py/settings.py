@@ -15,6 +15,8 @@ DEFAULTS = {
     "webhook": "",
     "thresholds": {"rttMs": 80, "lossPct": 2.0, "holdSec": 5},
     "backend_path": "",
+    "ipc": "jsonl",                     # 백엔드 출력 형식: jsonl, msgpack, cbor
+    "shm_path": "",                     # 지정 시 metrics를 공유 메모리 링(mmap 파일)으로 수신
     "autostart_backend": True,
     "simpleMode": False,
     "theme": "dark",
@@ -1068,6 +1068,10 @@ class DashboardView(QWidget):
         # 현재 시간
         now = time.time()
         
+        # 녹화 상태를 백엔드로 (녹화 중 쓰기 정체 감지)
+        if self.metric_bus:
+            self.metric_bus.set_recording(metrics.get('recording', False))
+        
         # PyQtGraph 위젯에 데이터 추가
         if hasattr(self, 'dropped_graph'):
             dropped_ratio = metrics.get('dropped_ratio', 0.0) * 100  # 퍼센트로 변환